@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "ds/binary_trees.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Key orders used for the add workloads.
+*
+* random:   shuffled keys, the best case for the unbalanced BinarySearchTree
+* sorted:   ascending keys, like time ordered ids
+* reversed: descending keys
+* zigzag:   0, n-1, 1, n-2, ... every add goes to the deepest leaf of a
+*           BinarySearchTree and keeps triggering rebalancing elsewhere
+*/
+vector<int> keys(string order, int n){
+	vector<int> k(n);
+	for (int i = 0; i < n; i++){
+		k[i] = i;
+	}
+	if (order == "random"){
+		random_shuffle(k.begin(), k.end());
+	} else if (order == "reversed"){
+		reverse(k.begin(), k.end());
+	} else if (order == "zigzag"){
+		for (int i = 0; i < n; i++){
+			k[i] = (i % 2 == 0) ? i/2 : n - 1 - i/2;
+		}
+	}
+	return k;
+}
+
+template <class Tree>
+void benchmarkTree(string name, int n){
+	const char* orders[] = {"random", "sorted", "reversed", "zigzag"};
+	for (int o = 0; o < 4; o++){
+		vector<int> k = keys(orders[o], n);
+		vector<int> probes = keys("random", n);
+		Tree* tree = new Tree();
+		long sum = 0;
+
+		benchmark(name, string("add ") + orders[o], n, [&](){
+			for (int i = 0; i < n; i++){
+				tree->add(k[i]);
+			}
+		});
+		benchmark(name, string("find after ") + orders[o], n, [&](){
+			for (int i = 0; i < n; i++){
+				sum += tree->find(probes[i]);
+			}
+		});
+		benchmark(name, string("scan after ") + orders[o], n, [&](){
+			for (typename Tree::iterator it = tree->begin(); it != tree->end(); ++it){
+				sum += *it;
+			}
+		});
+		benchmark(name, string("range scan after ") + orders[o], n, [&](){
+			for (int i = 0; i < n; i += 1000){
+				for (int x : tree->range(i, i + 1000)){
+					sum += x;
+				}
+			}
+		});
+		benchmark(name, string("remove after ") + orders[o], n, [&](){
+			for (int i = 0; i < n; i++){
+				tree->remove(probes[i]);
+			}
+		});
+
+		delete tree;
+		if (sum < 0){
+			cout << sum << endl;	// Keep the finds from being optimized away
+		}
+	}
+}
+
+/**
+* Merging m keys into a Treap of n keys, by repeated add() and by
+* unionWith(), then differencing and intersecting with m keys.
+* Half of the m keys are already in the larger Treap.
+*/
+void benchmarkSetAlgebra(int n, int m){
+	vector<int> k = keys("random", n + m);
+	string sizes = " " + to_string(n) + "/" + to_string(m);
+	Treap<int> a;
+	Treap<int> b;
+	for (int i = 0; i < n; i++){
+		a.add(k[i]);
+	}
+	for (int i = n - m/2; i < n + m/2; i++){
+		b.add(k[i]);
+	}
+
+	benchmark("Treap", "add loop" + sizes, m, [&](){
+		for (int i = n - m/2; i < n + m/2; i++){
+			a.add(k[i]);
+		}
+	});
+	for (int i = n; i < n + m/2; i++){
+		a.remove(k[i]);
+	}
+
+	benchmark("Treap", "unionWith" + sizes, m, [&](){
+		a.unionWith(b);
+	});
+
+	for (int i = n - m/2; i < n + m/2; i++){
+		b.add(k[i]);
+	}
+	benchmark("Treap", "differenceWith" + sizes, m, [&](){
+		a.differenceWith(b);
+	});
+
+	for (int i = 0; i < m; i++){
+		b.add(k[i]);
+	}
+	benchmark("Treap", "intersectWith" + sizes, m, [&](){
+		a.intersectWith(b);
+	});
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 20000;
+	srand(1);
+
+	cout << "Binary trees with n = " << n << endl;
+	benchmarkTree<BinarySearchTree<int> >("BinarySearchTree", n);
+	benchmarkTree<Treap<int> >("Treap", n);
+	benchmarkTree<RedBlackTree<int> >("RedBlackTree", n);
+	benchmarkTree<ScapegoatTree<int> >("ScapegoatTree", n);
+
+	cout << endl << "Treap set algebra" << endl;
+	benchmarkSetAlgebra(20*n, 20*n);
+	benchmarkSetAlgebra(20*n, n);
+
+	return 0;
+}
@@ -0,0 +1,97 @@
+#include <iostream>
+#include <mutex>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "ds/array_lists.h"
+#include "ds/concurrency.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Passing n items from 2 producers to 2 consumers. The baseline is
+* what the pipeline stages did before: an ArrayQueue behind a mutex,
+* with consumers polling it.
+*/
+template <class Produce, class Consume>
+void pipeline(Produce produce, Consume consume){
+	vector<thread> threads;
+	for (int t = 0; t < 2; t++){
+		threads.push_back(thread(produce, t));
+	}
+	for (int t = 0; t < 2; t++){
+		threads.push_back(thread(consume));
+	}
+	for (size_t t = 0; t < threads.size(); t++){
+		threads[t].join();
+	}
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 200000;
+	cout << "2 producers, 2 consumers, n = " << n << endl;
+	long sum = 0;
+	mutex sumLock;
+
+	benchmark("ArrayQueue + mutex", "poll", n, [&](){
+		ArrayQueue<int> q;
+		mutex lock;
+		int remaining = n;
+		pipeline([&](int t){
+			for (int i = t; i < n; i += 2){
+				lock_guard<mutex> held(lock);
+				q.enqueue(i);
+			}
+		}, [&](){
+			long local = 0;
+			while (true){
+				lock_guard<mutex> held(lock);
+				if (remaining == 0){
+					break;
+				}
+				if (q.size() > 0){
+					local += q.dequeue();
+					remaining--;
+				}
+			}
+			lock_guard<mutex> held(sumLock);
+			sum += local;
+		});
+	});
+
+	for (int k : {1, 64}){
+		benchmark("BlockingQueue", k == 1 ? "dequeue" : "dequeueBulk(64)", n, [&](){
+			BlockingQueue<int> q(1024);
+			int producing = 2;
+			mutex producingLock;
+			pipeline([&](int t){
+				for (int i = t; i < n; i += 2){
+					q.enqueue(i);
+				}
+				lock_guard<mutex> held(producingLock);
+				if (--producing == 0){
+					q.close();
+				}
+			}, [&](){
+				long local = 0;
+				int batch[64];
+				int got;
+				while ((got = q.dequeueBulk(batch, k)) > 0){
+					for (int i = 0; i < got; i++){
+						local += batch[i];
+					}
+				}
+				lock_guard<mutex> held(sumLock);
+				sum += local;
+			});
+		});
+	}
+
+	if (sum == 42){
+		cout << "";	// Keep the sums from being optimized away
+	}
+	return 0;
+}
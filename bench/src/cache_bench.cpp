@@ -0,0 +1,95 @@
+#include <iostream>
+#include <list>
+#include <stdlib.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ds/caches.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* The usual hand-built LRU cache, for comparison.
+*/
+class StdLRUCache {
+	list<pair<int, int> > entries;
+	unordered_map<int, list<pair<int, int> >::iterator> index;
+	int cap;
+
+public:
+	StdLRUCache(int capacity): cap(capacity) {}
+
+	int* lookup(int k){
+		auto it = index.find(k);
+		if (it == index.end()){
+			return nullptr;
+		}
+		entries.splice(entries.begin(), entries, it->second);
+		return &it->second->second;
+	}
+
+	void put(int k, int v){
+		if (int* p = lookup(k)){
+			*p = v;
+			return;
+		}
+		if ((int)entries.size() == cap){
+			index.erase(entries.back().first);
+			entries.pop_back();
+		}
+		entries.emplace_front(k, v);
+		index[k] = entries.begin();
+	}
+};
+
+/**
+* Read-through workload: look a key up, and put it on a miss. Keys
+* are skewed, with a few hot ones and a long tail, so the hit rate
+* depends on the eviction policy.
+*/
+template <class C>
+void benchmarkCache(string name, C &c, const vector<int> &keys){
+	long sum = 0;
+	benchmark(name, "lookup, put on miss", keys.size(), [&](){
+		for (size_t i = 0; i < keys.size(); i++){
+			int* v = c.lookup(keys[i]);
+			if (v == nullptr){
+				c.put(keys[i], keys[i]);
+			} else {
+				sum += *v;
+			}
+		}
+	});
+	if (sum == 42){
+		cout << "";	// Keep the lookups from being optimized away
+	}
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+	int capacity = 10000;
+	srand(1);
+
+	// Product of two uniform variables: heavily skewed towards small keys
+	vector<int> keys(n);
+	for (int i = 0; i < n; i++){
+		keys[i] = (int)((long)(rand() % 1000) * (rand() % 1000) / 5);
+	}
+
+	cout << "Caches with capacity " << capacity << ", n = " << n << endl;
+	StdLRUCache std(capacity);
+	benchmarkCache("std::list LRU", std, keys);
+
+	LRUCache<int, int> lru(capacity);
+	benchmarkCache("LRUCache", lru, keys);
+	cout << "  hit rate " << 100 * lru.stats().hitRate() << "%" << endl;
+
+	LFUCache<int, int> lfu(capacity);
+	benchmarkCache("LFUCache", lfu, keys);
+	cout << "  hit rate " << 100 * lfu.stats().hitRate() << "%" << endl;
+
+	return 0;
+}
@@ -0,0 +1,88 @@
+#include <iostream>
+#include <stdexcept>
+#include <stdlib.h>
+#include <vector>
+
+#include "ds/binary_trees.h"
+#include "ds/filters.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Exact membership probes where most values are absent. Without the
+* filter, each miss is a full descent and, if x is larger than every
+* value, an exception.
+*/
+template <class Set>
+bool contains(Set &set, int x){
+	try {
+		return set.find(x) == x;
+	} catch(out_of_range&){
+		return false;
+	}
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 200000;
+	srand(1);
+
+	// Even values are present, odd ones absent. One probe in ten is a hit.
+	vector<int> keys(n);
+	for (int i = 0; i < n; i++){
+		keys[i] = 2 * (rand() % 1000000000);
+	}
+	vector<int> probes(n);
+	for (int i = 0; i < n; i++){
+		probes[i] = (i % 10 == 0) ? keys[rand() % n] : 2 * (rand() % 1000000000) + 1;
+	}
+	// Misses past the largest key throw in the unfiltered set
+	for (int i = 5; i < n; i += 10){
+		probes[i] = 2000000001 + 2*i;
+	}
+
+	cout << "Membership probes, 90% misses, n = " << n << endl;
+	long found = 0;
+
+	Treap<int> plain;
+	for (int i = 0; i < n; i++){
+		plain.add(keys[i]);
+	}
+	benchmark("Treap", "find + catch", n, [&](){
+		for (int i = 0; i < n; i++){
+			found += contains(plain, probes[i]);
+		}
+	});
+
+	RedBlackTree<int> rb;
+	for (int i = 0; i < n; i++){
+		rb.add(keys[i]);
+	}
+	benchmark("RedBlackTree", "find + catch", n, [&](){
+		for (int i = 0; i < n; i++){
+			found += contains(rb, probes[i]);
+		}
+	});
+
+	for (double p : {0.01, 0.001}){
+		Treap<int> t;
+		FilteredSortedSet<int> s(t, n, p);
+		for (int i = 0; i < n; i++){
+			s.add(keys[i]);
+		}
+		benchmark("Filtered Treap", p == 0.01 ? "contains (1%)" : "contains (0.1%)", n, [&](){
+			for (int i = 0; i < n; i++){
+				found += s.contains(probes[i]);
+			}
+		});
+		FilterStats st = s.stats();
+		cout << "  saved " << 100 * st.savedRate() << "% of lookups, "
+			<< st.falsePositives << " false positives" << endl;
+	}
+
+	if (found == 42){
+		cout << "";	// Keep the lookups from being optimized away
+	}
+	return 0;
+}
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "ds/binary_trees.h"
+#include "ds/flat_sets.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* The same random keys are added one at a time, looked up, and (for
+* a sample) removed from a Treap and a FlatSortedSet. The flat set is
+* also built in one call to addAll(), the way a read-mostly set
+* would usually be loaded.
+*/
+template <class Set>
+void benchmarkSet(string name, const vector<unsigned> &keys, const vector<unsigned> &queries, int removals){
+	int n = keys.size();
+	Set* set = new Set();
+	unsigned long sum = 0;
+
+	benchmark(name, "add", n, [&](){
+		for (int i = 0; i < n; i++){
+			set->add(keys[i]);
+		}
+	});
+	benchmark(name, "find (hit)", n, [&](){
+		for (int i = 0; i < n; i++){
+			sum += set->find(keys[i]);
+		}
+	});
+	benchmark(name, "find (successor)", n, [&](){
+		for (int i = 0; i < n; i++){
+			sum += set->find(queries[i]);
+		}
+	});
+	benchmark(name, "remove", removals, [&](){
+		for (int i = 0; i < removals; i++){
+			set->remove(keys[i]);
+		}
+	});
+
+	delete set;
+	if (sum == 42){
+		cout << "";	// Keep the lookups from being optimized away
+	}
+}
+
+void benchmarkBulkLoad(const vector<unsigned> &keys, const vector<unsigned> &queries){
+	int n = keys.size();
+	FlatSortedSet<unsigned>* set = new FlatSortedSet<unsigned>();
+	unsigned long sum = 0;
+
+	benchmark("FlatSortedSet", "addAll", n, [&](){
+		set->addAll(&keys[0], n);
+	});
+	benchmark("FlatSortedSet", "find (successor) after addAll", n, [&](){
+		for (int i = 0; i < n; i++){
+			sum += set->find(queries[i]);
+		}
+	});
+
+	delete set;
+	if (sum == 42){
+		cout << "";
+	}
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 100000;
+	int removals = std::min(n, 10000);
+	srand(1);
+
+	// Distinct keys, with the largest value present so every successor search succeeds
+	vector<unsigned> keys(n);
+	for (int i = 0; i < n - 1; i++){
+		keys[i] = (unsigned)i * 2654435761u;
+	}
+	keys[n-1] = ~0u;
+	random_shuffle(keys.begin(), keys.end());
+	vector<unsigned> queries(n);
+	for (int i = 0; i < n; i++){
+		queries[i] = ((unsigned)rand() << 16) ^ (unsigned)rand();
+	}
+
+	cout << "Sorted sets with n = " << n << endl;
+	benchmarkSet<Treap<unsigned> >("Treap", keys, queries, removals);
+	benchmarkSet<FlatSortedSet<unsigned> >("FlatSortedSet", keys, queries, removals);
+	benchmarkBulkLoad(keys, queries);
+
+	return 0;
+}
@@ -0,0 +1,69 @@
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "ds/graphs.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+template <class Graph>
+void benchmarkTraversals(string name, Graph &g, int m){
+	int n = g.nVertices();
+	vector<int> dist(n);
+	vector<long> weighted(n);
+	benchmark(name, "bfs", m, [&](){
+		bfs(g, 0, &dist[0]);
+	});
+	benchmark(name, "dfs", m, [&](){
+		dfs(g, 0, &dist[0]);
+	});
+	benchmark(name, "dijkstra", m, [&](){
+		dijkstra(g, 0, &weighted[0]);
+	});
+}
+
+/**
+* A random graph with n vertices and average degree deg. Random graphs
+* have a small diameter, which is where direction-optimizing BFS helps.
+* Times are per edge.
+*/
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+	int deg = (argc > 2) ? atoi(argv[2]) : 8;
+	int m = n * deg;
+	srand(1);
+	vector<int> sources(m);
+	vector<int> targets(m);
+	vector<int> weights(m);
+	for (int k = 0; k < m; k++){
+		sources[k] = rand() % n;
+		targets[k] = rand() % n;
+		weights[k] = 1 + rand() % 100;
+	}
+
+	cout << "Graphs with n = " << n << ", m = " << m << endl;
+	AdjacencyLists* lists = new AdjacencyLists(n);
+	benchmark("AdjacencyLists", "build", m, [&](){
+		for (int k = 0; k < m; k++){
+			lists->addEdge(sources[k], targets[k]);
+		}
+	});
+	benchmarkTraversals("AdjacencyLists", *lists, m);
+	delete lists;
+
+	CSRGraph* csr = nullptr;
+	benchmark("CSRGraph", "build", m, [&](){
+		csr = new CSRGraph(n, m, &sources[0], &targets[0], &weights[0]);
+	});
+	benchmarkTraversals("CSRGraph", *csr, m);
+	vector<int> dist(n);
+	benchmark("CSRGraph", "parallelBFS", m, [&](){
+		parallelBFS(*csr, 0, &dist[0]);
+	});
+	delete csr;
+
+	return 0;
+}
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "ds/binary_trees.h"
+#include "ds/hash_tables.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Treap is what callers use for membership tests today,
+* and std::unordered_set is the standard library's chained table.
+*/
+class TreapSet {
+	Treap<int> treap;
+public:
+	bool add(int x){ return treap.add(x); }
+	void remove(int x){ treap.remove(x); }
+	bool contains(int x){
+		BTIterator<int> it = treap.lower_bound(x);
+		return it != treap.end() && *it == x;
+	}
+};
+
+class StdSet {
+	unordered_set<int> set;
+public:
+	bool add(int x){ return set.insert(x).second; }
+	void remove(int x){ set.erase(x); }
+	bool contains(int x){ return set.count(x) > 0; }
+};
+
+/**
+* Keys are distinct but scattered (multiplying by an odd constant is a
+* bijection), so hits and misses are spread over the whole table.
+*/
+template <class Set>
+void benchmarkSet(string name, int n){
+	vector<int> keys(2*n);
+	for (int i = 0; i < 2*n; i++){
+		keys[i] = (int)(i * 2654435761u);
+	}
+	random_shuffle(keys.begin(), keys.end());
+	Set* set = new Set();
+	long found = 0;
+
+	benchmark(name, "add", n, [&](){
+		for (int i = 0; i < n; i++){
+			set->add(keys[i]);
+		}
+	});
+	benchmark(name, "contains (hit)", n, [&](){
+		for (int i = 0; i < n; i++){
+			found += set->contains(keys[i]);
+		}
+	});
+	benchmark(name, "contains (miss)", n, [&](){
+		for (int i = n; i < 2*n; i++){
+			found += set->contains(keys[i]);
+		}
+	});
+	benchmark(name, "remove/add churn", n, [&](){
+		for (int i = 0; i < n; i++){
+			set->remove(keys[i]);
+			set->add(keys[n+i]);
+		}
+	});
+
+	delete set;
+	if (found == 42){
+		cout << "";	// Keep the lookups from being optimized away
+	}
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+	srand(1);
+
+	cout << "Hash sets with n = " << n << endl;
+	benchmarkSet<TreapSet>("Treap", n);
+	benchmarkSet<StdSet>("std::unordered_set", n);
+	benchmarkSet<ChainedHashTable<int> >("ChainedHashTable", n);
+	benchmarkSet<LinearHashTable<int> >("LinearHashTable", n);
+	benchmarkSet<SwissHashSet<int> >("SwissHashSet", n);
+
+	return 0;
+}
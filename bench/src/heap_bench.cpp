@@ -0,0 +1,127 @@
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "ds/binary_trees.h"
+#include "ds/heaps.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Treap add plus find-min is what schedulers use as a priority queue
+* today, and std::priority_queue is the standard library's binary heap.
+* Duplicate keys are made distinct for the Treap, since it is a set.
+*/
+class TreapQueue {
+	Treap<long> treap;
+	long seq = 0;
+public:
+	void add(int x){ treap.add(((long)x << 32) | seq++); }
+	int remove(){ return (int)(treap.remove(*treap.begin()) >> 32); }
+};
+
+class StdQueue {
+	priority_queue<int, vector<int>, greater<int> > pq;
+public:
+	void add(int x){ pq.push(x); }
+	int remove(){ int x = pq.top(); pq.pop(); return x; }
+};
+
+template <class Queue>
+void benchmarkQueue(string name, const vector<int> &keys){
+	int n = keys.size();
+	Queue* q = new Queue();
+	long sum = 0;
+
+	benchmark(name, "add", n, [&](){
+		for (int i = 0; i < n; i++){
+			q->add(keys[i]);
+		}
+	});
+	benchmark(name, "remove/add (steady)", n, [&](){
+		for (int i = 0; i < n; i++){
+			int x = q->remove();
+			sum += x;
+			q->add(x + keys[i] % 1024);
+		}
+	});
+	benchmark(name, "remove", n, [&](){
+		for (int i = 0; i < n; i++){
+			sum += q->remove();
+		}
+	});
+
+	delete q;
+	if (sum == 42){
+		cout << "";	// Keep the removals from being optimized away
+	}
+}
+
+template <int D>
+void benchmarkHeapify(string name, const vector<int> &keys){
+	BinaryHeap<int, D> h;
+	benchmark(name, "addAll (heapify)", keys.size(), [&](){
+		h.addAll(&keys[0], keys.size());
+	});
+}
+
+void benchmarkStdHeapify(const vector<int> &keys){
+	benchmark("std::priority_queue", "range ctor (heapify)", keys.size(), [&](){
+		priority_queue<int, vector<int>, greater<int> > pq(keys.begin(), keys.end());
+		if (pq.top() == 42){
+			cout << "";
+		}
+	});
+}
+
+/**
+* Build many small heaps and meld them pairwise down to one.
+*/
+void benchmarkMeld(const vector<int> &keys, int heaps){
+	int n = keys.size();
+	vector<MeldableHeap<int>*> hs(heaps);
+	for (int j = 0; j < heaps; j++){
+		hs[j] = new MeldableHeap<int>();
+	}
+	for (int i = 0; i < n; i++){
+		hs[i % heaps]->add(keys[i]);
+	}
+	benchmark("MeldableHeap", "meld", heaps - 1, [&](){
+		for (int step = 1; step < heaps; step *= 2){
+			for (int j = 0; j + step < heaps; j += 2*step){
+				hs[j]->meld(*hs[j + step]);
+			}
+		}
+	});
+	for (int j = 0; j < heaps; j++){
+		delete hs[j];
+	}
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+	srand(1);
+	vector<int> keys(n);
+	for (int i = 0; i < n; i++){
+		keys[i] = rand();
+	}
+
+	cout << "Priority queues with n = " << n << endl;
+	benchmarkQueue<TreapQueue>("Treap", keys);
+	benchmarkQueue<StdQueue>("std::priority_queue", keys);
+	benchmarkQueue<BinaryHeap<int, 2> >("BinaryHeap<2>", keys);
+	benchmarkQueue<BinaryHeap<int, 4> >("BinaryHeap<4>", keys);
+	benchmarkQueue<MeldableHeap<int> >("MeldableHeap", keys);
+
+	benchmarkStdHeapify(keys);
+	benchmarkHeapify<2>("BinaryHeap<2>", keys);
+	benchmarkHeapify<4>("BinaryHeap<4>", keys);
+	benchmarkMeld(keys, 1024);
+
+	return 0;
+}
@@ -0,0 +1,51 @@
+/**
+* Minimal timing harness shared by the benchmarks.
+*
+* Each workload is a callable that performs ops operations. It is run
+* once and the elapsed wall-clock time is reported per operation,
+* one line per container and workload so that results can be compared
+* with sort or a spreadsheet.
+*
+* Where the CPU's performance counters can be read (see
+* perf_counters.cpp), the line goes on to give cycles, instructions
+* and cache, branch and TLB misses per operation, eg
+*
+*   DLList   get(i)   41.3 ns/op   152.10 cycles   20.40 instr   1.02 L1d ...
+*
+* which shows whether a structure is paying for memory latency or for
+* the instructions it runs. Otherwise only the time is given.
+*/
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "./perf_counters.cpp"
+
+template <class F>
+double timeWorkload(F workload){
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	workload();
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+template <class F>
+void benchmark(std::string container, std::string workload, long ops, F f){
+	PerfCounters &counters = PerfCounters::instance();
+	counters.start();
+	double ns = timeWorkload(f);
+	std::vector<double> counts = counters.stop();
+
+	std::cout << std::left << std::setw(20) << container
+		<< std::setw(28) << workload
+		<< std::right << std::setw(12) << std::fixed << std::setprecision(1) << ns / ops
+		<< " ns/op";
+	std::vector<std::string> names = counters.names();
+	for (size_t i = 0; i < counts.size(); i++){
+		std::cout << std::setw(12) << std::setprecision(2) << counts[i] / ops << " " << names[i];
+	}
+	std::cout << std::setprecision(1) << std::endl;
+}
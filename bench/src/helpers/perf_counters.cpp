@@ -0,0 +1,134 @@
+/**
+* Hardware performance counters for the benchmark harness, read with
+* Linux perf_event_open around each workload.
+*
+*   cycles, instr:  CPU cycles and instructions retired
+*   L1d, LLC:       level 1 data cache and last level cache misses
+*   branch:         mispredicted branches
+*   dTLB:           data TLB misses
+*
+* Each counter is opened on its own rather than as a group, so a CPU
+* (or virtual machine) without one of them still reports the others.
+* If there are more counters than the CPU can count at once, the
+* kernel time-shares them and the counts are scaled up by the fraction
+* of the time each was running. Counters are inherited, so threads
+* started by a workload are counted too.
+*
+* When perf_event_paranoid forbids user space counting, or the CPU
+* exposes no counters (common under virtualization), nothing opens and
+* the harness falls back to wall-clock time alone.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+class PerfCounters {
+	struct Counter {
+		std::string name;
+		int fd;
+	};
+	std::vector<Counter> counters;
+
+	PerfCounters();
+	void open(const char* name, unsigned int type, unsigned long long config);
+
+public:
+	PerfCounters(const PerfCounters&) = delete;
+	PerfCounters& operator=(const PerfCounters&) = delete;
+	~PerfCounters();
+	static PerfCounters& instance();
+
+	bool available();
+	std::vector<std::string> names();	// Of the counters that opened
+	void start();
+	std::vector<double> stop();	// One count per name
+};
+
+
+inline PerfCounters& PerfCounters::instance(){
+	static PerfCounters counters;
+	return counters;
+}
+
+inline PerfCounters::PerfCounters(){
+	unsigned long long read = PERF_COUNT_HW_CACHE_OP_READ << 8;
+	unsigned long long miss = PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+	open("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+	open("instr", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+	open("L1d", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | read | miss);
+	open("LLC", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+	open("branch", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+	open("dTLB", PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | read | miss);
+	if (counters.empty()){
+		std::cerr << "(performance counters unavailable, reporting time only)" << std::endl;
+	}
+}
+
+inline PerfCounters::~PerfCounters(){
+	for (size_t i = 0; i < counters.size(); i++){
+		close(counters[i].fd);
+	}
+}
+
+inline void PerfCounters::open(const char* name, unsigned int type, unsigned long long config){
+	perf_event_attr attr;
+	std::memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = 1;
+	attr.inherit = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	int fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);	// This thread, any CPU
+	if (fd >= 0){
+		counters.push_back(Counter{name, fd});
+	}
+}
+
+inline bool PerfCounters::available(){
+	return !counters.empty();
+}
+
+inline std::vector<std::string> PerfCounters::names(){
+	std::vector<std::string> result;
+	for (size_t i = 0; i < counters.size(); i++){
+		result.push_back(counters[i].name);
+	}
+	return result;
+}
+
+inline void PerfCounters::start(){
+	for (size_t i = 0; i < counters.size(); i++){
+		ioctl(counters[i].fd, PERF_EVENT_IOC_RESET, 0);
+		ioctl(counters[i].fd, PERF_EVENT_IOC_ENABLE, 0);
+	}
+}
+
+/**
+* Each read gives the count, then the time the counter was enabled
+* and the time it was actually counting.
+*/
+inline std::vector<double> PerfCounters::stop(){
+	for (size_t i = 0; i < counters.size(); i++){
+		ioctl(counters[i].fd, PERF_EVENT_IOC_DISABLE, 0);
+	}
+	std::vector<double> counts;
+	for (size_t i = 0; i < counters.size(); i++){
+		unsigned long long values[3] = {0, 0, 0};
+		double count = 0;
+		if (::read(counters[i].fd, values, sizeof(values)) == sizeof(values) && values[2] > 0){
+			count = (double)values[0] * values[1] / values[2];
+		}
+		counts.push_back(count);
+	}
+	return counts;
+}
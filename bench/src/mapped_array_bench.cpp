@@ -0,0 +1,65 @@
+#include <cstdio>
+#include <iostream>
+#include <stdlib.h>
+
+#include "ds/array_lists.h"
+#include "ds/mapped_arrays.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Appending to and scanning a log, on the heap and in a mapped file.
+* Resizing the heap array copies everything, resizing the file doesn't.
+*/
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 4000000;
+	const char* path = "/tmp/ods_mapped_bench.arr";
+	remove(path);
+
+	cout << "Append-only log, n = " << n << endl;
+	long sum = 0;
+
+	ArrayStack<long> heap;
+	benchmark("ArrayStack", "push", n, [&](){
+		for (int i = 0; i < n; i++){
+			heap.push(i);
+		}
+	});
+	benchmark("ArrayStack", "scan", n, [&](){
+		for (int i = 0; i < n; i++){
+			sum += heap.get(i);
+		}
+	});
+
+	{
+		MappedArrayStack<long> log(path);
+		benchmark("MappedArrayStack", "push", n, [&](){
+			for (int i = 0; i < n; i++){
+				log.push(i);
+			}
+		});
+		log.adviseSequential();
+		benchmark("MappedArrayStack", "scan", n, [&](){
+			for (long i = 0; i < n; i++){
+				sum += log.get(i);
+			}
+		});
+	}
+	{
+		MappedArrayStack<long> log(path);
+		log.adviseSequential();
+		benchmark("MappedArrayStack", "reopen + scan", n, [&](){
+			for (long i = 0; i < n; i++){
+				sum += log.get(i);
+			}
+		});
+	}
+
+	remove(path);
+	if (sum == 42){
+		cout << "";	// Keep the scans from being optimized away
+	}
+	return 0;
+}
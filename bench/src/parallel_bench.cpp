@@ -0,0 +1,71 @@
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+
+#include "ds/array_lists.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Batch work over a whole list: doubling every element, summing and
+* taking running totals, each timed as a single threaded loop over
+* get(i) and set(i, x) and as the list's parallel algorithm. With
+* several cores the parallel versions should speed up until they run
+* out of memory bandwidth.
+*/
+template <class List>
+void benchmarkParallel(string name, int n){
+	List* list = new List();
+	for (int i = 0; i < n; i++){
+		list->add(list->size(), rand() % 1000);
+	}
+	long found = 0;
+
+	benchmark(name, "double via get/set", n, [&](){
+		for (int i = 0; i < n; i++){
+			list->set(i, 2 * list->get(i));
+		}
+	});
+	benchmark(name, "transform", n, [&](){
+		list->transform([](int x){ return x / 2; });
+	});
+	benchmark(name, "sum via get(i)", n, [&](){
+		long s = 0;
+		for (int i = 0; i < n; i++){
+			s += list->get(i);
+		}
+		found += s;
+	});
+	benchmark(name, "reduce", n, [&](){
+		found += list->reduce(0L, [](long s, long x){ return s + x; });
+	});
+	benchmark(name, "running total via get/set", n, [&](){
+		for (int i = 1; i < n; i++){
+			list->set(i, list->get(i-1) + list->get(i));
+		}
+	});
+	benchmark(name, "inclusiveScan", n, [&](){
+		list->inclusiveScan([](int a, int b){ return a - b; });
+	});
+
+	if (found == 42){
+		cout << "";	// Keep the sums from being optimized away
+	}
+	delete list;
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+	srand(1);
+
+	cout << "Parallel algorithms with n = " << n << " on " << thread::hardware_concurrency() << " cores" << endl;
+	benchmarkParallel<ArrayStack<int> >("ArrayStack", n);
+	benchmarkParallel<FastArrayStack<int> >("FastArrayStack", n);
+	benchmarkParallel<ArrayDeque<int> >("ArrayDeque", n);
+	benchmarkParallel<DualArrayDeque<int> >("DualArrayDeque", n);
+
+	return 0;
+}
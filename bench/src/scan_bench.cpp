@@ -0,0 +1,104 @@
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+
+#include "ds/array_lists.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Filter-style scans over whole lists: looking for a value that isn't
+* there, counting, and min and sum. Each is timed as a loop over
+* get(i) and as the list's own scan, and reported per element.
+*
+* Built with -march=native, so the SIMD scans use AVX2 where the
+* machine has it.
+*/
+template <class List, class T>
+void benchmarkScans(string name, List &list, int reps){
+	long ops = (long)reps * list.size();
+	int n = list.size();
+	T missing = -1;
+	long found = 0;
+
+	benchmark(name, "indexOf via get(i)", ops, [&](){
+		for (int r = 0; r < reps; r++){
+			for (int i = 0; i < n; i++){
+				if (list.get(i) == missing){
+					found += i;
+					break;
+				}
+			}
+		}
+	});
+	benchmark(name, "indexOf", ops, [&](){
+		for (int r = 0; r < reps; r++){
+			found += list.indexOf(missing);
+		}
+	});
+	benchmark(name, "count via get(i)", ops, [&](){
+		for (int r = 0; r < reps; r++){
+			for (int i = 0; i < n; i++){
+				found += (list.get(i) == (T)r);
+			}
+		}
+	});
+	benchmark(name, "count", ops, [&](){
+		for (int r = 0; r < reps; r++){
+			found += list.count((T)r);
+		}
+	});
+	benchmark(name, "sum via get(i)", ops, [&](){
+		for (int r = 0; r < reps; r++){
+			typename ScanSum<T>::type s = 0;
+			for (int i = 0; i < n; i++){
+				s += list.get(i);
+			}
+			found += (long)s;
+		}
+	});
+	benchmark(name, "sum", ops, [&](){
+		for (int r = 0; r < reps; r++){
+			found += (long)list.sum();
+		}
+	});
+	benchmark(name, "min", ops, [&](){
+		for (int r = 0; r < reps; r++){
+			found += (long)list.min();
+		}
+	});
+
+	if (found == 42){
+		cout << "";	// Keep the scans from being optimized away
+	}
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 100000;
+	int reps = 200;
+	srand(1);
+
+	cout << "Scans with n = " << n << ", times per element" << endl;
+
+	ArrayStack<int> as;
+	ArrayDeque<int> ad;
+	ArrayStack<double> ds;
+	for (int i = 0; i < n; i++){
+		int x = rand() % 1000;
+		as.push(x);
+		ds.push(x);
+		if (i % 2 == 0){
+			ad.addFirst(x);	// So the elements wrap around the backing array
+		} else {
+			ad.addLast(x);
+		}
+	}
+
+	benchmarkScans<ArrayStack<int>, int>("ArrayStack<int>", as, reps);
+	benchmarkScans<ArrayDeque<int>, int>("ArrayDeque<int>", ad, reps);
+	benchmarkScans<ArrayStack<double>, double>("ArrayStack<double>", ds, reps);
+
+	return 0;
+}
@@ -0,0 +1,150 @@
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "ds/array_lists.h"
+#include "ds/binary_trees.h"
+#include "ds/linked_lists.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Editor-like workload: every add, get and remove is at a random
+* position, so the array lists shift half their elements on average
+* and the DLList walks a quarter of its nodes. Reading in order shows
+* the cost of pointer chasing against ArrayDeque's modulo arithmetic.
+*/
+template <class List>
+void benchmarkList(string name, int n){
+	List* list = new List();
+	long sum = 0;
+	vector<int> positions(n);
+	for (int i = 0; i < n; i++){
+		positions[i] = rand() % (i + 1);
+	}
+
+	benchmark(name, "add(random i)", n, [&](){
+		for (int i = 0; i < n; i++){
+			list->add(positions[i], i);
+		}
+	});
+	benchmark(name, "get(random i)", n, [&](){
+		for (int i = 0; i < n; i++){
+			sum += list->get(positions[n - 1 - i]);
+		}
+	});
+	benchmark(name, "get(i) in order", n, [&](){
+		for (int i = 0; i < n; i++){
+			sum += list->get(i);
+		}
+	});
+	benchmark(name, "remove(random i)", n, [&](){
+		for (int i = n - 1; i >= 0; i--){
+			sum += list->remove(positions[i]);
+		}
+	});
+
+	delete list;
+	if (sum == 42){
+		cout << "";	// Keep the lookups from being optimized away
+	}
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 20000;
+	srand(1);
+
+	cout << "Sequences with n = " << n << endl;
+	benchmarkList<ArrayStack<int> >("ArrayStack", n);
+	benchmarkList<FastArrayStack<int> >("FastArrayStack", n);
+	benchmarkList<ArrayDeque<int> >("ArrayDeque", n);
+	benchmarkList<DualArrayDeque<int> >("DualArrayDeque", n);
+	benchmarkList<DLList<int> >("DLList", n);
+	benchmarkList<ImplicitTreap<int> >("ImplicitTreap", n);
+
+	// Operations only the ImplicitTreap can do in O(log(n))
+	ImplicitTreap<int> t;
+	for (int i = 0; i < n; i++){
+		t.add(i, i);
+	}
+	benchmark("ImplicitTreap", "reverse(random range)", n, [&](){
+		for (int i = 0; i < n; i++){
+			int a = rand() % n;
+			int b = rand() % n;
+			t.reverse(min(a, b), max(a, b));
+		}
+	});
+	benchmark("ImplicitTreap", "splitAt + concat", n, [&](){
+		ImplicitTreap<int> front;
+		for (int i = 0; i < n; i++){
+			t.splitAt(rand() % n, front);
+			front.concat(t);
+			t.concat(front);
+		}
+	});
+
+	// Capacity control: pre-sizing a bulk load, and a stack that keeps
+	// emptying and refilling by one element
+	long ops = 100L * n;
+	benchmark("ArrayStack", "push (no reserve)", ops, [&](){
+		ArrayStack<int> s;
+		for (long i = 0; i < ops; i++){
+			s.push(i);
+		}
+	});
+	benchmark("ArrayStack", "reserve + push", ops, [&](){
+		ArrayStack<int> s;
+		s.reserve(ops);
+		for (long i = 0; i < ops; i++){
+			s.push(i);
+		}
+	});
+	benchmark("ArrayStack", "push + pop at size 0", ops, [&](){
+		ArrayStack<int> s;
+		for (long i = 0; i < ops; i++){
+			s.push(i);
+			s.pop();
+		}
+	});
+
+	// Many short lived stacks and queues of up to 12 elements, where the
+	// inline slots save an allocation at each doubling
+	long stacks = ops / 12;
+	benchmark("ArrayStack", "12 pushes per new stack", ops, [&](){
+		for (long k = 0; k < stacks; k++){
+			ArrayStack<int> s;
+			for (int i = 0; i < 12; i++){
+				s.push(i);
+			}
+		}
+	});
+	benchmark("ArrayStack<int, 16>", "12 pushes per new stack", ops, [&](){
+		for (long k = 0; k < stacks; k++){
+			ArrayStack<int, 16> s;
+			for (int i = 0; i < 12; i++){
+				s.push(i);
+			}
+		}
+	});
+	benchmark("ArrayQueue", "12 enqueues per new queue", ops, [&](){
+		for (long k = 0; k < stacks; k++){
+			ArrayQueue<int> q;
+			for (int i = 0; i < 12; i++){
+				q.enqueue(i);
+			}
+		}
+	});
+	benchmark("ArrayQueue<int, 16>", "12 enqueues per new queue", ops, [&](){
+		for (long k = 0; k < stacks; k++){
+			ArrayQueue<int, 16> q;
+			for (int i = 0; i < 12; i++){
+				q.enqueue(i);
+			}
+		}
+	});
+
+	return 0;
+}
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ds/binary_trees.h"
+#include "ds/skiplists.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* The baseline is what the indexers do today: a Treap behind a global lock.
+*/
+class LockedTreap {
+	Treap<int> treap;
+	mutex lock;
+
+public:
+	bool add(int x){
+		lock_guard<mutex> guard(lock);
+		return treap.add(x);
+	}
+	int remove(int x){
+		lock_guard<mutex> guard(lock);
+		return treap.remove(x);
+	}
+	int find(int x){
+		lock_guard<mutex> guard(lock);
+		return treap.find(x);
+	}
+};
+
+/**
+* Each thread performs ops operations on keys in [0, range), of which
+* readPercent are find() and the rest are split between add and remove.
+*/
+template <class Set>
+void mixedWorkload(Set &set, int threads, int ops, int range, int readPercent){
+	vector<thread> workers;
+	for (int t = 0; t < threads; t++){
+		workers.push_back(thread([&set, t, ops, range, readPercent](){
+			unsigned z = 2463534242u + t * 7919;
+			long sum = 0;
+			for (int i = 0; i < ops; i++){
+				z ^= z << 13;
+				z ^= z >> 17;
+				z ^= z << 5;
+				int x = z % range;
+				int op = (z >> 16) % 100;
+				try {
+					if (op < readPercent){
+						sum += set.find(x);
+					} else if (op % 2 == 0){
+						set.add(x);
+					} else {
+						set.remove(x);
+					}
+				} catch(std::out_of_range&){
+				}
+			}
+			if (sum == 42){
+				cout << "";	// Keep the finds from being optimized away
+			}
+		}));
+	}
+	for (size_t t = 0; t < workers.size(); t++){
+		workers[t].join();
+	}
+}
+
+template <class Set>
+void benchmarkSet(string name, int maxThreads, int ops, int range){
+	int readPercents[] = {90, 50};
+	const char* labels[] = {"read-mostly", "write-heavy"};
+	for (int w = 0; w < 2; w++){
+		// Doubling, then all cores, eg 1 2 4 8 12 on 12 cores
+		for (int threads = 1; ; threads = std::min(2 * threads, maxThreads)){
+			Set set;
+			for (int i = 0; i < range; i += 2){
+				set.add(i);
+			}
+			benchmark(name, string(labels[w]) + " x" + to_string(threads), (long)threads * ops, [&](){
+				mixedWorkload(set, threads, ops, range, readPercents[w]);
+			});
+			if (threads >= maxThreads){
+				break;
+			}
+		}
+	}
+}
+
+int main(int argc, char** argv){
+	int ops = (argc > 1) ? atoi(argv[1]) : 200000;
+	int maxThreads = std::max(1, (argc > 2) ? atoi(argv[2]) : (int)thread::hardware_concurrency());
+	int range = 100000;
+	srand(1);
+
+	cout << "Concurrent sorted sets, " << ops << " ops per thread, keys in [0, " << range << ")" << endl;
+	cout << "(ns/op is wall-clock time divided by the total operations of all threads)" << endl;
+	benchmarkSet<LockedTreap>("Treap + mutex", maxThreads, ops, range);
+	benchmarkSet<ConcurrentSkiplistSSet<int> >("ConcurrentSkiplist", maxThreads, ops, range);
+
+	return 0;
+}
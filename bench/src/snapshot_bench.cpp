@@ -0,0 +1,96 @@
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <stdlib.h>
+#include <vector>
+
+#include "ds/array_lists.h"
+#include "ds/binary_trees.h"
+#include "ds/snapshots.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Getting a structure back from disk: rebuilding it with n adds,
+* against mapping a snapshot and searching it in place.
+*/
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 200000;
+	const char* listPath = "/tmp/ods_list_bench.snap";
+	const char* setPath = "/tmp/ods_set_bench.snap";
+	srand(1);
+
+	vector<int> keys(n);
+	for (int i = 0; i < n; i++){
+		keys[i] = rand() % 1000000000;
+	}
+	vector<int> probes(n);
+	for (int i = 0; i < n; i++){
+		probes[i] = rand() % 1000000000;
+	}
+
+	cout << "Loading and searching, n = " << n << endl;
+	long found = 0;
+
+	ArrayStack<int> stack;
+	for (int i = 0; i < n; i++){
+		stack.add(stack.size(), keys[i]);
+	}
+	saveList(stack, listPath);
+	benchmark("ArrayStack", "rebuild + sum", n, [&](){
+		ArrayStack<int> s;
+		for (int i = 0; i < n; i++){
+			s.add(s.size(), keys[i]);
+		}
+		for (int i = 0; i < n; i++){
+			found += s.get(i);
+		}
+	});
+	benchmark("ListView", "open + sum", n, [&](){
+		ListView<int> v(listPath);
+		for (int x : v){
+			found += x;
+		}
+	});
+
+	Treap<int> t;
+	for (int i = 0; i < n; i++){
+		t.add(keys[i]);
+	}
+	saveSortedSet(t, setPath);
+	benchmark("Treap", "rebuild + find", n, [&](){
+		Treap<int> s;
+		for (int i = 0; i < n; i++){
+			s.add(keys[i]);
+		}
+		for (int i = 0; i < n; i++){
+			try {
+				found += s.find(probes[i]);
+			} catch(out_of_range&){}
+		}
+	});
+	benchmark("Treap", "find", n, [&](){
+		for (int i = 0; i < n; i++){
+			try {
+				found += t.find(probes[i]);
+			} catch(out_of_range&){}
+		}
+	});
+	benchmark("SortedSetView", "open + find", n, [&](){
+		SortedSetView<int> v(setPath);
+		for (int i = 0; i < n; i++){
+			try {
+				found += v.find(probes[i]);
+			} catch(out_of_range&){}
+		}
+	});
+
+	remove(listPath);
+	remove(setPath);
+	if (found == 42){
+		cout << "";	// Keep the lookups from being optimized away
+	}
+	return 0;
+}
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "ds/array_lists.h"
+#include "ds/sorting.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* What callers do today: copy the elements out with get(i),
+* sort them with std::sort and write them back with set(i, x).
+*/
+template <class List>
+void sortByCopying(List &l){
+	int n = l.size();
+	vector<int> v(n);
+	for (int i = 0; i < n; i++){
+		v[i] = l.get(i);
+	}
+	sort(v.begin(), v.end());
+	for (int i = 0; i < n; i++){
+		l.set(i, v[i]);
+	}
+}
+
+template <class Sort>
+void benchmarkSort(string name, string workload, const vector<int> &keys, Sort sortRange){
+	vector<int> v(keys);
+	benchmark(name, workload, v.size(), [&](){
+		sortRange(&v[0], (int)v.size());
+	});
+	if (!is_sorted(v.begin(), v.end())){
+		cout << name << " didn't sort " << workload << endl;
+	}
+}
+
+void benchmarkArrays(string workload, const vector<int> &keys){
+	benchmarkSort("std::sort", workload, keys, [](int* a, int n){ sort(a, a + n); });
+	benchmarkSort("std::stable_sort", workload, keys, [](int* a, int n){ stable_sort(a, a + n); });
+	benchmarkSort("mergeSort", workload, keys, mergeSort<int>);
+	benchmarkSort("parallelMergeSort", workload, keys, parallelMergeSort<int>);
+	benchmarkSort("quickSort", workload, keys, quickSort<int>);
+	benchmarkSort("radixSort", workload, keys, radixSort<int>);
+	benchmarkSort("parallelRadixSort", workload, keys, parallelRadixSort<int>);
+}
+
+template <class List>
+void benchmarkList(string name, const vector<int> &keys){
+	int n = keys.size();
+	List* l = new List();
+	for (int i = 0; i < n; i++){
+		l->add(l->size(), keys[i]);
+	}
+	benchmark(name, "get/std::sort/set", n, [&](){
+		sortByCopying(*l);
+	});
+	delete l;
+
+	l = new List();
+	for (int i = 0; i < n; i++){
+		l->add(l->size(), keys[i]);
+	}
+	benchmark(name, "sort(radixSort)", n, [&](){
+		l->sort(radixSort<int>);
+	});
+	delete l;
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+	srand(1);
+	vector<int> random(n);
+	vector<int> sorted(n);
+	vector<int> fewDistinct(n);
+	for (int i = 0; i < n; i++){
+		random[i] = rand();
+		sorted[i] = i;
+		fewDistinct[i] = rand() % 16;
+	}
+
+	cout << "Sorting with n = " << n << endl;
+	benchmarkArrays("random", random);
+	benchmarkArrays("sorted", sorted);
+	benchmarkArrays("16 distinct", fewDistinct);
+
+	benchmarkList<ArrayStack<int> >("ArrayStack", random);
+	benchmarkList<ArrayDeque<int> >("ArrayDeque", random);
+	benchmarkList<DualArrayDeque<int> >("DualArrayDeque", random);
+
+	return 0;
+}
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "ds/binary_trees.h"
+#include "ds/tries.h"
+
+using namespace std;
+
+#include "./helpers/benchmark.cpp"
+
+/**
+* Every container is filled with the same random 32-bit keys, then
+* queried with keys that are present (hits) and with random keys,
+* which are almost all misses and need a successor search.
+*/
+template <class Set>
+void benchmarkSet(string name, const vector<unsigned> &keys, const vector<unsigned> &queries){
+	int n = keys.size();
+	Set* set = new Set();
+	unsigned long sum = 0;
+
+	benchmark(name, "add", n, [&](){
+		for (int i = 0; i < n; i++){
+			set->add(keys[i]);
+		}
+	});
+	benchmark(name, "find (hit)", n, [&](){
+		for (int i = 0; i < n; i++){
+			sum += set->find(keys[i]);
+		}
+	});
+	benchmark(name, "find (successor)", n, [&](){
+		for (int i = 0; i < n; i++){
+			sum += set->find(queries[i]);
+		}
+	});
+	benchmark(name, "remove", n, [&](){
+		for (int i = 0; i < n; i++){
+			set->remove(keys[i]);
+		}
+	});
+
+	delete set;
+	if (sum == 42){
+		cout << "";	// Keep the lookups from being optimized away
+	}
+}
+
+int main(int argc, char** argv){
+	int n = (argc > 1) ? atoi(argv[1]) : 200000;
+	srand(1);
+
+	// Distinct keys, with the largest value present so every successor search succeeds
+	vector<unsigned> keys(n);
+	for (int i = 0; i < n - 1; i++){
+		keys[i] = (unsigned)i * 2654435761u;
+	}
+	keys[n-1] = ~0u;
+	random_shuffle(keys.begin(), keys.end());
+	vector<unsigned> queries(n);
+	for (int i = 0; i < n; i++){
+		queries[i] = ((unsigned)rand() << 16) ^ (unsigned)rand();
+	}
+
+	cout << "Integer sorted sets with n = " << n << endl;
+	benchmarkSet<Treap<unsigned> >("Treap", keys, queries);
+	benchmarkSet<BinaryTrie<unsigned> >("BinaryTrie", keys, queries);
+	benchmarkSet<XFastTrie<unsigned> >("XFastTrie", keys, queries);
+	benchmarkSet<YFastTrie<unsigned> >("YFastTrie", keys, queries);
+
+	return 0;
+}
@@ -1,23 +1,74 @@
 #ifndef ARRAY_H
 #define ARRAY_H
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
+#include <utility>
+
+/**
+* Storage for the first N slots of an Array, inside the Array itself.
+* With N = 0 (the default) this is an empty base class, so it takes
+* no space.
+*/
+template <class T, int N>
+class InlineSlots {
+	T slots[N];
+
+protected:
+	T* inlineSlots() { return slots; }
+	void moveIntoSlots(T* b, int l) { std::move(b, b + l, slots); }
+};
 
 template <class T>
-class Array {
+class InlineSlots<T, 0> {
+protected:
+	T* inlineSlots() { return nullptr; }
+	void moveIntoSlots(T*, int) {}
+};
+
+
+template <class T, int N = 0>
+class Array : InlineSlots<T, N> {
 	T *a;
 	int l;
 
 public:
 	Array(); // Default constructor
 	Array(int len);
+	Array(const Array<T, N>&) = delete;	// Would share (or, inline, point into) b's slots
+	Array<T, N>& operator=(const Array<T, N>&) = delete;
+	Array(Array<T, N> &&b);
+	Array<T, N>& operator=(Array<T, N> &&b);	// Leaves b with a valid, unspecified array
 	~Array();
-	Array<T>& operator=(Array<T> &b);	// Copy constructor
 	T& operator[](int i);
 	int length();
+	bool isInline();	// Using the N inline slots rather than the heap
 	std::string draw();
 };
 
+/**
+* When the containers built on Array give memory back. An array is
+* shrunk once it is factor times larger than needed, to twice the
+* size needed, and never below minLength. Since arrays grow to twice
+* their size when full, a container has to halve (or double) before
+* it resizes again, so one that hovers around a size, eg alternating
+* push and pop while nearly empty, doesn't reallocate every time.
+*/
+struct ShrinkPolicy {
+	int factor;
+	int minLength;
+
+	ShrinkPolicy(int factor = 4, int minLength = 8): factor(factor), minLength(minLength) {
+		if (factor < 3 || minLength < 1){
+			throw std::invalid_argument("shrink policy needs factor >= 3 and minLength >= 1");
+		}
+	}
+
+	bool shrinks(long length, long n) const { return length > minLength && length >= factor * n; }
+	long shrunkLength(long n) const { return std::max(2 * n, (long)minLength); }
+};
+
 #include "../../src/Array.cpp"
 
 #endif
@@ -6,18 +6,45 @@
 #include "./interfaces/queue.h"
 #include "./interfaces/stack.h"
 #include "./array.h"
+#include "./instrument.h"
+#include "./memory.h"
+#include "./parallel.h"
+#include "./scans.h"
 
 template <class T>
-class ArrayStack : public IList<T>, public IStack<T> {
-	Array<T> a;
+class DualArrayDeque;
+
+template <class T>
+class FlatSortedSet;
+
+
+/**
+* N > 0 keeps the first N elements inside the stack itself, see Array,
+* so a stack that stays that small never allocates:
+*
+*   ArrayStack<int, 16> s;	// Spills to the heap at the 17th element
+*/
+template <class T, int N = 0>
+class ArrayStack : public IList<T>, public IStack<T>, Counters<Instrumented<ArrayStack<T, N> >::value> {
+	Array<T, N> a;
 	int n = 0;
+	ShrinkPolicy policy;
+
+	template <class U>
+	friend class DualArrayDeque;	// Balances and runs the parallel algorithms on both halves' arrays
 
-	void resize();
+	void resize(int length);
 
 public:
+	ArrayStack(): Counters<Instrumented<ArrayStack<T, N> >::value>("ArrayStack") {}
+	ArrayStack(const ArrayStack<T, N>&) = delete;	// See Array
+	ArrayStack<T, N>& operator=(const ArrayStack<T, N>&) = delete;
+	ArrayStack(ArrayStack<T, N> &&b);
+	ArrayStack<T, N>& operator=(ArrayStack<T, N> &&b);	// Leaves b empty
+
 	// List methods
 	int size();
-	T get(int i);
+	const T& get(int i);
 	T set(int i, T x);
 	void add(int i, T x);
 	T remove(int i);
@@ -25,19 +52,61 @@ public:
 	// Stack methods. Will delegate to list methods
 	void push(T x);
 	T pop();
+
+	// Capacity control, see ShrinkPolicy in ds/array.h
+	int capacity();
+	void reserve(int m);	// Make room for m elements
+	void shrinkToFit();
+	ShrinkPolicy shrinkPolicy();
+	void setShrinkPolicy(ShrinkPolicy p);
+
+	template <class Sort>
+	void sort(Sort sortRange);	// Sort in place with sortRange(T* a, int n), eg mergeSort<T>
+
+	// Scans over the backing array, see ds/scans.h
+	int indexOf(const T& x);	// First i with get(i) == x, or -1
+	bool contains(const T& x);
+	int count(const T& x);
+	T min();	// Throw std::out_of_range if the list is empty
+	T max();
+	typename ScanSum<T>::type sum();
+
+	// Parallel algorithms over the backing array, see ds/parallel.h
+	template <class F>
+	void forEach(F f);	// f(x) for every element x, in no particular order
+	template <class F>
+	void transform(F f);	// Replace every x with f(x)
+	template <class S, class Op>
+	S reduce(S init, Op op);	// init op x0 op x1 op ..., op must be associative
+	template <class Op>
+	void inclusiveScan(Op op);	// Replace xi with x0 op ... op xi
+
+	OpStats stats();	// All zero unless instrumented, see ds/instrument.h
+	long bytesUsed();	// See ds/memory.h
+	long bytesReserved();
 };
 
 
 template <class T>
-class FastArrayStack : public IList<T>, public IStack<T> {
+class FastArrayStack : public IList<T>, public IStack<T>, Counters<Instrumented<FastArrayStack<T> >::value> {
 	Array<T> a;
 	int n = 0;
+	ShrinkPolicy policy;
+
+	template <class U>
+	friend class FlatSortedSet;	// Binary searches and merges the backing array directly
 
-	void resize();
+	void resize(int length);
 
 public:
+	FastArrayStack(): Counters<Instrumented<FastArrayStack<T> >::value>("FastArrayStack") {}
+	FastArrayStack(const FastArrayStack<T>&) = delete;	// See Array
+	FastArrayStack<T>& operator=(const FastArrayStack<T>&) = delete;
+	FastArrayStack(FastArrayStack<T> &&b);
+	FastArrayStack<T>& operator=(FastArrayStack<T> &&b);	// Leaves b empty
+
 	int size();
-	T get(int i);
+	const T& get(int i);
 	T set(int i, T x);
 	void add(int i, T x);
 	T remove(int i);
@@ -45,22 +114,72 @@ public:
 	// Stack methods. Will delegate to list methods
 	void push(T x);
 	T pop();
+
+	int capacity();
+	void reserve(int m);
+	void shrinkToFit();
+	ShrinkPolicy shrinkPolicy();
+	void setShrinkPolicy(ShrinkPolicy p);
+
+	template <class Sort>
+	void sort(Sort sortRange);
+
+	int indexOf(const T& x);
+	bool contains(const T& x);
+	int count(const T& x);
+	T min();
+	T max();
+	typename ScanSum<T>::type sum();
+
+	template <class F>
+	void forEach(F f);
+	template <class F>
+	void transform(F f);
+	template <class S, class Op>
+	S reduce(S init, Op op);
+	template <class Op>
+	void inclusiveScan(Op op);
+
+	OpStats stats();
+	long bytesUsed();
+	long bytesReserved();
 };
 
 
-template <class T>
-class ArrayQueue : public IQueue<T> {
+/**
+* Like ArrayStack, N > 0 gives the queue N inline slots.
+*/
+template <class T, int N = 0>
+class ArrayQueue : public IQueue<T>, protected Counters<Instrumented<ArrayQueue<T, N> >::value> {
 protected:
-	Array<T> a;
+	Array<T, N> a;
 	int j = 0;
 	int n = 0;
+	ShrinkPolicy policy;
 
-	void resize();
+	ArrayQueue(const char* name): Counters<Instrumented<ArrayQueue<T, N> >::value>(name) {}
+	void resize(int length);
 
 public:
+	ArrayQueue(): Counters<Instrumented<ArrayQueue<T, N> >::value>("ArrayQueue") {}
+	ArrayQueue(const ArrayQueue<T, N>&) = delete;	// See Array
+	ArrayQueue<T, N>& operator=(const ArrayQueue<T, N>&) = delete;
+	ArrayQueue(ArrayQueue<T, N> &&b);
+	ArrayQueue<T, N>& operator=(ArrayQueue<T, N> &&b);	// Leaves b empty
+
 	int size();
 	void enqueue(T x);
 	T dequeue();
+
+	int capacity();
+	void reserve(int m);
+	void shrinkToFit();
+	ShrinkPolicy shrinkPolicy();
+	void setShrinkPolicy(ShrinkPolicy p);
+
+	OpStats stats();
+	long bytesUsed();
+	long bytesReserved();
 };
 
 
@@ -71,8 +190,10 @@ public:
 template <class T>
 class ArrayDeque : public ArrayQueue<T>, public IDeque<T>, public IStack<T>, public IList<T>{
 public:
+	ArrayDeque(): ArrayQueue<T>("ArrayDeque") {}
+
 	int size();	// Would prefer to use the one defined in ArrayQueue
-	T get(int i);
+	const T& get(int i);
 	T set(int i, T x);
 	void add(int i, T x);
 	T remove(int i);
@@ -84,22 +205,70 @@ public:
 
 	void push(T x);
 	T pop();
+
+	template <class Sort>
+	void sort(Sort sortRange);
+
+	// Scans over the one or two segments of the backing array, see ds/scans.h
+	int indexOf(const T& x);
+	bool contains(const T& x);
+	int count(const T& x);
+	T min();
+	T max();
+	typename ScanSum<T>::type sum();
+
+	// Parallel algorithms over the same segments, see ds/parallel.h
+	template <class F>
+	void forEach(F f);
+	template <class F>
+	void transform(F f);
+	template <class S, class Op>
+	S reduce(S init, Op op);
+	template <class Op>
+	void inclusiveScan(Op op);
 };
 
 
 template <class T>
-class DualArrayDeque : public IList<T>{
+class DualArrayDeque : public IList<T>, Counters<Instrumented<DualArrayDeque<T> >::value> {
 	ArrayStack<T> front;
 	ArrayStack<T> back;
+	int reserved = 0;	// The last reserve(m), which balance() keeps until the policy would shrink it
 
 	void balance();
+	void moveBottom(ArrayStack<T> &from, ArrayStack<T> &to, int k);
 
 public:
+	DualArrayDeque(): Counters<Instrumented<DualArrayDeque<T> >::value>("DualArrayDeque") {}
+
 	int size();
-	T get(int i);
+	const T& get(int i);
 	T set(int i, T x);
 	void add(int i, T x);
 	T remove(int i);
+
+	int capacity();
+	void reserve(int m);	// Split between the two halves
+	void shrinkToFit();
+	ShrinkPolicy shrinkPolicy();
+	void setShrinkPolicy(ShrinkPolicy p);
+
+	template <class Sort>
+	void sort(Sort sortRange);
+
+	// Parallel algorithms over the two backing arrays, see ds/parallel.h
+	template <class F>
+	void forEach(F f);
+	template <class F>
+	void transform(F f);
+	template <class S, class Op>
+	S reduce(S init, Op op);
+	template <class Op>
+	void inclusiveScan(Op op);
+
+	OpStats stats();
+	long bytesUsed();
+	long bytesReserved();
 };
 
 
@@ -1,10 +1,19 @@
 #ifndef BINARY_TREES_H
 #define BINARY_TREES_H
 
+#include <atomic>
+#include <cstddef>
+#include <iterator>
 #include <sstream>
 #include <string>
+#include <utility>
 
+#include "./interfaces/list.h"
 #include "./interfaces/sortedset.h"
+#include "./array.h"
+#include "./concurrency.h"
+#include "./instrument.h"
+#include "./memory.h"
 
 template <class T>
 class BTNode {
@@ -15,7 +24,7 @@ public:
 	BTNode<T>* right;
 
 	BTNode(){};
-	BTNode(T _x): x(_x), parent(nullptr), left(nullptr), right(nullptr) {}
+	BTNode(T _x): x(std::move(_x)), parent(nullptr), left(nullptr), right(nullptr) {}
 };
 
 
@@ -27,7 +36,7 @@ public:
 	TreapNode(){}
 	TreapNode(T _x, int _p): p(_p){
 		// Can I just delegate these calls to BTNode constructor?
-		this->x = _x;
+		this->x = std::move(_x);
 		this->parent = nullptr;
 		this->left = nullptr;
 		this->right = nullptr;
@@ -41,6 +50,100 @@ public:
 };
 
 
+/**
+* Node of an ImplicitTreap. Its position is not stored anywhere, it is
+* the number of nodes before it in an in-order traversal, which is
+* worked out from the subtree sizes on the way down.
+*/
+template <class T>
+class ImplicitTreapNode: public TreapNode<T> {
+public:
+	int size;	// Nodes in this subtree
+	bool reversed;	// The subtree below still has to be mirrored
+
+	ImplicitTreapNode(T _x, int _p): TreapNode<T>(std::move(_x), _p), size(1), reversed(false) {}
+};
+
+
+template <class T>
+class RedBlackNode: public BTNode<T> {
+public:
+	char colour;
+
+	RedBlackNode(): colour(1) {}
+	RedBlackNode(T _x): BTNode<T>(std::move(_x)), colour(0) {}
+};
+
+
+/**
+* Node of a PersistentTreap. Nodes are shared between versions of the
+* tree and never modified once they are reachable, so there is no
+* parent pointer. refs counts the parents and trees that point here.
+*/
+template <class T>
+class PersistentTreapNode {
+public:
+	const T x;
+	const int p;
+	PersistentTreapNode<T>* left;
+	PersistentTreapNode<T>* right;
+	std::atomic<int> refs;
+
+	PersistentTreapNode(T _x, int _p): x(std::move(_x)), p(_p), left(nullptr), right(nullptr), refs(1) {}
+};
+
+
+/**
+* Bidirectional in-order iterator over any of the binary search trees.
+* Moves between nodes using the parent pointers, so it needs no stack
+* and never allocates. The end position is represented by nullptr.
+*/
+template <class T>
+class BTIterator {
+	BTNode<T>* u;
+	BTNode<T>* const* root;	// Needed to step back from end()
+
+public:
+	typedef std::bidirectional_iterator_tag iterator_category;
+	typedef T value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const T* pointer;
+	typedef const T& reference;
+
+	BTIterator(): u(nullptr), root(nullptr) {}
+	BTIterator(BTNode<T>* _u, BTNode<T>* const* _root): u(_u), root(_root) {}
+
+	static BTNode<T>* next(BTNode<T>* u);
+	static BTNode<T>* prev(BTNode<T>* u);
+
+	const T& operator*() const { return u->x; }
+	const T* operator->() const { return &u->x; }
+	BTIterator<T>& operator++();
+	BTIterator<T> operator++(int);
+	BTIterator<T>& operator--();
+	BTIterator<T> operator--(int);
+	bool operator==(const BTIterator<T> &b) const { return u == b.u; }
+	bool operator!=(const BTIterator<T> &b) const { return u != b.u; }
+};
+
+
+/**
+* The keys in [first, last), for use in range-based for loops.
+*/
+template <class T>
+class BTRange {
+	BTIterator<T> first;
+	BTIterator<T> last;
+
+public:
+	BTRange(BTIterator<T> _first, BTIterator<T> _last): first(_first), last(_last) {}
+
+	BTIterator<T> begin() const { return first; }
+	BTIterator<T> end() const { return last; }
+	bool empty() const { return first == last; }
+};
+
+
 template <class T>
 class RecursiveBinaryTree {
 	BTNode<T>* root;
@@ -52,49 +155,237 @@ public:
 };
 
 
+/**
+* BinarySearchTree also acts as the base class for the balanced trees.
+* The protected helpers (findLast, addChild, splice and the rotations)
+* only rely on the parent/left/right pointers in BTNode, so subclasses
+* can reuse them with their own node types.
+*/
 template <class T>
 class BinarySearchTree: public ISortedSet<T>{
+protected:
 	BTNode<T>* root;
 
+	BTNode<T>* findLast(const T& x);
+	BTNode<T>* findNode(const T& x);
+	bool addChild(BTNode<T>* parent, BTNode<T>* u);
+	void splice(BTNode<T>* removalNode);
+	void rotateLeft(BTNode<T>* u);
+	void rotateRight(BTNode<T>* u);
+	int subtreeSize(BTNode<T>* u);
+	virtual long nodeBytes();	// sizeof the subclass's node type
+	template <class Node>
+	void deleteTree();	// Deletes every node as a Node, leaving the tree empty
+
 	BTNode<T>* smallestNodeInSubtree(BTNode<T>* startNode);
 	BTNode<T>* largestNodeInSubtree(BTNode<T>* startNode);
 	BTNode<T>* findSmallerParent(BTNode<T>* node);
-	void splice(BTNode<T>* removalNode);
 
 public:
+	typedef BTIterator<T> iterator;
+
 	BinarySearchTree(): root(nullptr) {}
+	BinarySearchTree(const BinarySearchTree<T>&) = delete;	// The tree owns its nodes
+	BinarySearchTree<T>& operator=(const BinarySearchTree<T>&) = delete;
+	virtual ~BinarySearchTree();
+
+	// In-order traversal and range scans
+	iterator begin();
+	iterator end();
+	iterator lower_bound(T x);	// First key >= x
+	iterator upper_bound(T x);	// First key > x
+	BTRange<T> range(T a, T b);	// Keys in [a, b)
 
 	int size();
 	bool add(T x);
 	T remove(T x);
-	T find(T x);	// return smallest number that is greater than or equal to x
+	T find(const T& x);	// return smallest number that is greater than or equal to x
 	T secondLargest();
 	T nthLargest(int n);
 	void draw();
+
+	long bytesUsed();	// See ds/memory.h
+	long bytesReserved();
 };
 
 
 template <class T>
-class Treap: public ISortedSet<T>{
-	BTNode<T>* root;
+class Treap: public BinarySearchTree<T>, Counters<Instrumented<Treap<T> >::value> {
 	int n = 0;
 
-	void rotateLeft(BTNode<T>*);
-	void rotateRight(BTNode<T>*);
-	void splice(BTNode<T>* removalNode);
+	static int priority(BTNode<T>* u);
+	static void setChildren(BTNode<T>* u, BTNode<T>* l, BTNode<T>* r);
+	static void deleteNode(BTNode<T>* u);
+	static void deleteNodes(BTNode<T>* u);
+	static void split(BTNode<T>* u, T x, BTNode<T>* &l, BTNode<T>* &found, BTNode<T>* &r);
+	static BTNode<T>* join(BTNode<T>* l, BTNode<T>* r);
+	static BTNode<T>* unionNodes(BTNode<T>* a, BTNode<T>* b, int depth, int &duplicates);
+	static BTNode<T>* intersectNodes(BTNode<T>* a, BTNode<T>* b, int depth, int &kept);
+	static BTNode<T>* differenceNodes(BTNode<T>* a, BTNode<T>* b, int depth, int &removed);
+
+protected:
+	long nodeBytes();
 
 public:
-	Treap(): root(nullptr) {}
+	Treap(): Counters<Instrumented<Treap<T> >::value>("Treap") {}
+	~Treap();
 
 	int size();
 	bool add(T x);
 	T remove(T x);
-	T find(T x);
 	void draw();
+
+	// Set algebra. Each of these takes the nodes of b, leaving it empty.
+	void unionWith(Treap<T> &b);
+	void intersectWith(Treap<T> &b);
+	void differenceWith(Treap<T> &b);
+	void splitAt(T x, Treap<T> &b);	// Moves the values <= x into b, replacing its contents
+
+	OpStats stats();	// All zero unless instrumented, see ds/instrument.h
+};
+
+
+/**
+* Treap keyed by position rather than value, implementing IList.
+* Sequences can be split and concatenated in O(log(n)), and any range
+* reversed lazily.
+*/
+template <class T>
+class ImplicitTreap: public IList<T>{
+	typedef ImplicitTreapNode<T> Node;
+
+	Node* root = nullptr;
+
+	static int size(Node* u);
+	static Node* child(BTNode<T>* u);
+	static void update(Node* u);
+	static void pushDown(Node* u);
+	static void split(Node* u, int i, Node* &l, Node* &r);
+	static Node* join(Node* l, Node* r);
+	static void deleteNodes(Node* u);
+	Node* getNode(int i);
+	void checkIndex(int i, int n);
+
+public:
+	ImplicitTreap() {}
+	ImplicitTreap(const ImplicitTreap<T>&) = delete;
+	ImplicitTreap<T>& operator=(const ImplicitTreap<T>&) = delete;
+	~ImplicitTreap();
+
+	int size();
+	const T& get(int i);
+	T set(int i, T x);
+	void add(int i, T x);
+	T remove(int i);
+
+	void concat(ImplicitTreap<T> &b);	// Appends the elements of b, leaving it empty
+	void splitAt(int i, ImplicitTreap<T> &b);	// Moves the first i elements into b, replacing its contents
+	void reverse(int i, int j);	// Reverses the elements in [i, j)
+
+	long bytesUsed();
+	long bytesReserved();
+};
+
+
+/**
+* Left-leaning red-black tree, colours are stored as
+* 0 (red), 1 (black) and 2 (double black, only during removal).
+*/
+template <class T>
+class RedBlackTree: public BinarySearchTree<T>{
+	int n = 0;
+	RedBlackNode<T> nil;	// Stands in for a missing child while removeFixup runs
+
+	static const char red = 0;
+	static const char black = 1;
+
+	char colour(BTNode<T>* u);
+	void setColour(BTNode<T>* u, char c);
+	void pushBlack(BTNode<T>* u);
+	void pullBlack(BTNode<T>* u);
+	void flipLeft(BTNode<T>* u);
+	void flipRight(BTNode<T>* u);
+	void addFixup(BTNode<T>* u);
+	void removeFixup(BTNode<T>* u);
+	BTNode<T>* removeFixupCase1(BTNode<T>* u);
+	BTNode<T>* removeFixupCase2(BTNode<T>* u);
+	BTNode<T>* removeFixupCase3(BTNode<T>* u);
+	int verify(BTNode<T>* u);
+
+protected:
+	long nodeBytes();
+
+public:
+	~RedBlackTree();
+
+	int size();
+	bool add(T x);
+	T remove(T x);
+	int verify();	// Checks the red-black properties, returns the black height
+};
+
+
+template <class T>
+class ScapegoatTree: public BinarySearchTree<T>{
+	int n = 0;
+	int q = 0;	// Upper bound on n, reset whenever the whole tree is rebuilt
+
+	int addWithDepth(BTNode<T>* u);
+	void rebuild(BTNode<T>* u);
+	int packIntoArray(BTNode<T>* u, Array<BTNode<T>*> &a, int i);
+	BTNode<T>* buildBalanced(Array<BTNode<T>*> &a, int i, int ns);
+
+public:
+	int size();
+	bool add(T x);
+	T remove(T x);
+};
+
+/**
+* Treap in which add() and remove() leave the previous version intact.
+* snapshot() is O(1) and the snapshot never changes, whatever happens
+* to the tree it was taken from.
+*/
+template <class T>
+class PersistentTreap: public ISortedSet<T>{
+	typedef PersistentTreapNode<T> Node;
+
+	Node* root;
+	int n;
+
+	PersistentTreap(Node* _root, int _n): root(retain(_root)), n(_n) {}
+
+	static Node* retain(Node* u);
+	static void release(Node* u);
+	Node* findNode(const T& x);
+	Node* insert(Node* u, T &x, int p);	// Moves x into the new leaf
+	Node* erase(Node* u, const T& x);
+	Node* merge(Node* a, Node* b);
+
+public:
+	PersistentTreap(): root(nullptr), n(0) {}
+	PersistentTreap(const PersistentTreap<T> &b): root(retain(b.root)), n(b.n) {}
+	PersistentTreap<T>& operator=(const PersistentTreap<T> &b);
+	~PersistentTreap();
+
+	int size();
+	bool add(T x);
+	T remove(T x);
+	T find(const T& x);
+	PersistentTreap<T> snapshot();
+
+	long bytesUsed();
+	long bytesReserved();
 };
 
+#include "../../src/binarytrees/BTIterator.cpp"
 #include "../../src/binarytrees/RecursiveBinaryTree.cpp"
 #include "../../src/binarytrees/BinarySearchTree.cpp"
 #include "../../src/binarytrees/Treap.cpp"
+#include "../../src/binarytrees/TreapSetAlgebra.cpp"
+#include "../../src/binarytrees/ImplicitTreap.cpp"
+#include "../../src/binarytrees/RedBlackTree.cpp"
+#include "../../src/binarytrees/ScapegoatTree.cpp"
+#include "../../src/binarytrees/PersistentTreap.cpp"
 
 #endif
@@ -0,0 +1,110 @@
+#ifndef CACHES_H
+#define CACHES_H
+
+#include "./hash_tables.h"
+#include "./linked_lists.h"
+#include "./memory.h"
+
+template <class K, class V>
+class CacheEntry {
+public:
+	K key;
+	V value;
+	long bytes;
+	long uses;	// Lookups since the entry was put, plus one
+};
+
+
+struct CacheStats {
+	long hits = 0;
+	long misses = 0;
+	long evictions = 0;
+	long rejections = 0;	// Entries heavier than the whole capacity
+
+	double hitRate() const { return hits + misses == 0 ? 0 : (double)hits / (hits + misses); }
+};
+
+
+/**
+* Key-value cache with a fixed capacity. Each entry has a weight
+* (1 by default, so capacity counts entries, or its size in bytes)
+* and entries are evicted, in an order chosen by the subclass, to
+* keep the total weight within the capacity.
+*/
+template <class K, class V>
+class Cache {
+protected:
+	typedef DNode<CacheEntry<K, V> > Node;
+
+	DLList<CacheEntry<K, V> > entries;	// Next to evict at the back
+	SwissHashMap<K, Node*> index;
+	long cap;
+	long w = 0;	// Total weight of the entries
+	CacheStats counts;
+
+	virtual void placeNew(Node* u) = 0;	// u has just been added at the back
+	virtual void touch(Node* u) = 0;	// u->x.uses has just been incremented
+	virtual void unlink(Node* u) = 0;	// u is about to be removed
+	void removeNode(Node* u);
+	void evict(Node* keep);
+
+public:
+	Cache(long capacity);
+	Cache(const Cache<K, V>&) = delete;
+	Cache<K, V>& operator=(const Cache<K, V>&) = delete;
+	virtual ~Cache(){}
+
+	int size();
+	long weight();
+	long capacity();
+
+	bool put(K k, V v, long bytes = 1);	// Returns false if the entry can't fit
+	V* lookup(K k);	// Pointer to the value, or nullptr on a miss. Invalidated by put or remove
+	V get(K k);	// Throws on a miss
+	bool contains(K k);	// Doesn't count as a use
+	V remove(K k);
+	void clear();
+
+	CacheStats stats();
+	void resetStats();
+
+	long bytesUsed();	// See ds/memory.h. The weights passed to put() are separate
+	virtual long bytesReserved();
+};
+
+
+template <class K, class V>
+class LRUCache : public Cache<K, V> {
+	typedef typename Cache<K, V>::Node Node;
+
+	void placeNew(Node* u);
+	void touch(Node* u);
+	void unlink(Node* u);
+
+public:
+	LRUCache(long capacity);
+};
+
+
+template <class K, class V>
+class LFUCache : public Cache<K, V> {
+	typedef typename Cache<K, V>::Node Node;
+
+	SwissHashMap<long, Node*> heads;	// The most recent entry with each use count
+
+	void placeNew(Node* u);
+	void touch(Node* u);
+	void unlink(Node* u);
+	void advanceHead(Node* u, long uses);
+
+public:
+	LFUCache(long capacity);
+
+	long bytesReserved();
+};
+
+#include "../../src/caches/Cache.cpp"
+#include "../../src/caches/LRUCache.cpp"
+#include "../../src/caches/LFUCache.cpp"
+
+#endif
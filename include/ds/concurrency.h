@@ -0,0 +1,133 @@
+#ifndef CONCURRENCY_H
+#define CONCURRENCY_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "./interfaces/queue.h"
+#include "./array.h"
+
+/**
+* Epoch-based memory reclamation, shared by the concurrent containers.
+*
+* Threads call enter() before reading a shared structure and exit()
+* afterwards (EpochGuard does both). Nodes unlinked from a structure
+* are passed to retire() rather than deleted, and are only freed once
+* every thread that could still be reading them has left.
+*/
+class EpochManager {
+	struct Retired {
+		void* p;
+		void (*deleter)(void*);
+		unsigned long epoch;
+	};
+
+	struct ThreadRecord {
+		std::atomic<unsigned long> epoch;
+		std::atomic<bool> active;
+		std::atomic<bool> inUse;
+		ThreadRecord* next;
+		int nesting;
+		std::vector<Retired> retired;
+	};
+
+	// Releases the calling thread's record when the thread exits
+	struct ThreadHandle {
+		ThreadRecord* record = nullptr;
+		~ThreadHandle();
+	};
+
+	std::atomic<unsigned long> globalEpoch;
+	std::atomic<ThreadRecord*> records;
+	std::mutex orphanLock;
+	std::vector<Retired> orphans;	// Left behind by threads that have exited
+
+	static const int collectInterval = 64;
+
+	EpochManager(): globalEpoch(0), records(nullptr) {}
+	ThreadRecord* record();
+	bool tryAdvance();
+	void freeRetired(std::vector<Retired> &retired, unsigned long epoch);
+
+public:
+	~EpochManager();
+	static EpochManager& instance();
+
+	void enter();
+	void exit();
+	void retire(void* p, void (*deleter)(void*));
+	void collect();
+};
+
+
+class EpochGuard {
+public:
+	EpochGuard() { EpochManager::instance().enter(); }
+	~EpochGuard() { EpochManager::instance().exit(); }
+};
+
+template <class F1, class F2>
+void forkJoin(bool fork, F1 left, F2 right);	// Run left and right, in parallel if fork is true
+template <class F>
+void forkEach(int tasks, F f);	// Run f(0), ..., f(tasks-1), each on its own thread
+inline int forkDepth(long n);	// How many levels of recursion should fork for an input of size n
+
+
+/**
+* Bounded multi-producer, multi-consumer queue. Producers block while
+* it is full and consumers while it is empty. Once closed, nothing more
+* can be enqueued, and consumers drain what is left.
+*/
+template <class T>
+class BlockingQueue : public IQueue<T> {
+	Array<T> a;	// Ring of capacity() slots, as in ArrayQueue
+	int j = 0;
+	int n = 0;
+	bool isClosed = false;
+
+	std::mutex lock;
+	std::condition_variable notEmpty;
+	std::condition_variable notFull;
+	int waitingConsumers = 0;
+	int waitingProducers = 0;
+
+	void push(T x);
+	T pop();
+	void wakeConsumer(std::unique_lock<std::mutex> &held);
+	void wakeProducers(std::unique_lock<std::mutex> &held, int freed);
+
+public:
+	BlockingQueue(int capacity);
+	BlockingQueue(const BlockingQueue<T>&) = delete;
+	BlockingQueue<T>& operator=(const BlockingQueue<T>&) = delete;
+
+	int size();
+	int capacity();
+
+	void enqueue(T x);	// Waits for room. Throws if the queue is closed
+	T dequeue();	// Waits for an element. Throws once the queue is closed and empty
+	bool tryEnqueue(T x);	// Returns false instead of waiting
+	bool tryDequeue(T &x);
+	template <class Rep, class Period>
+	bool tryEnqueueFor(T x, std::chrono::duration<Rep, Period> timeout);
+	template <class Rep, class Period>
+	bool tryDequeueFor(T &x, std::chrono::duration<Rep, Period> timeout);
+
+	int dequeueBulk(T* out, int k);	// Waits, then takes up to k. Returns 0 once closed and empty
+	int tryDequeueBulk(T* out, int k);
+
+	void close();	// Wakes every waiting thread
+	bool closed();
+
+	long bytesUsed();	// See ds/memory.h
+	long bytesReserved();
+};
+
+#include "../../src/concurrency/EpochManager.cpp"
+#include "../../src/concurrency/ForkJoin.cpp"
+#include "../../src/concurrency/BlockingQueue.cpp"
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef FILTERS_H
+#define FILTERS_H
+
+#include "./interfaces/sortedset.h"
+#include "./array.h"
+
+/**
+* Approximate set membership. mightContain(x) is always true for a
+* value that was added, and false for most others.
+*/
+template <class T>
+class BloomFilter {
+	static const int blockWords = 8;	// 512 bits, one cache line
+	static const unsigned long long golden = 0x9E3779B97F4A7C15ull;
+
+	Array<unsigned long long> storage;
+	unsigned long long* blocks;	// storage, aligned to a cache line
+	int nBlocks;
+	int k;	// Bits set for each value
+	int n = 0;
+
+	static unsigned long long hash(const T &x);
+
+public:
+	BloomFilter(int capacity, double falsePositiveRate);
+	BloomFilter(const BloomFilter<T>&) = delete;
+	BloomFilter<T>& operator=(const BloomFilter<T>&) = delete;
+
+	void add(T x);
+	bool mightContain(T x);
+	void clear();
+	int size();	// Values added since the last clear()
+	long bytesUsed();	// See ds/memory.h. A filter keeps no values, so this is its bits
+	long bytesReserved();
+	double fillRatio();	// Fraction of the bits that are set
+	double falsePositiveRate();	// Estimated from the fill ratio
+};
+
+
+struct FilterStats {
+	long lookups = 0;	// Calls to contains()
+	long filtered = 0;	// Answered by the filter alone
+	long hits = 0;	// Found in the set
+	long falsePositives = 0;	// Passed the filter, but not in the set
+
+	double savedRate() const { return lookups == 0 ? 0 : (double)filtered / lookups; }
+};
+
+
+/**
+* Puts a BloomFilter in front of an ISortedSet, so that most lookups
+* of absent values never reach the set. The set must be empty to start
+* with and only be modified through the wrapper.
+*/
+template <class T>
+class FilteredSortedSet: public ISortedSet<T> {
+	ISortedSet<T> &set;
+	BloomFilter<T> filter;
+	FilterStats counts;
+
+public:
+	FilteredSortedSet(ISortedSet<T> &_set, int capacity, double falsePositiveRate = 0.01);
+
+	int size();
+	bool add(T x);
+	T remove(T x);
+	T find(const T& x);	// Not filtered, since the answer is usually another value
+	bool contains(T x);
+
+	FilterStats stats();
+	void resetStats();
+
+	long bytesUsed();	// Only the filter's. The wrapped set reports its own memory
+	long bytesReserved();
+};
+
+#include "../../src/filters/BloomFilter.cpp"
+#include "../../src/filters/FilteredSortedSet.cpp"
+
+#endif
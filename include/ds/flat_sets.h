@@ -0,0 +1,39 @@
+#ifndef FLAT_SETS_H
+#define FLAT_SETS_H
+
+#include "./interfaces/sortedset.h"
+#include "./array_lists.h"
+#include "./memory.h"
+#include "./sorting.h"
+
+/**
+* Sorted set kept in sorted arrays rather than nodes. New values wait
+* in a small sorted array until there are enough to merge into the
+* main one in a single pass.
+*/
+template <class T>
+class FlatSortedSet : public ISortedSet<T> {
+	FastArrayStack<T> a;	// Sorted
+	FastArrayStack<T> pending;	// Sorted, added since the last merge, and none of them in a
+
+	static int lowerBound(const T* b, int n, const T& x);	// First i with b[i] >= x, or n
+	int pendingLimit();
+	void merge();
+
+public:
+	int size();
+	bool add(T x);
+	T remove(T x);
+	T find(const T& x);	// Smallest value >= x
+	bool contains(const T& x);
+
+	int addAll(const T* xs, int m);	// Any order, duplicates allowed. Returns how many were new
+	void compact();	// Merge the pending values now, eg before a read-mostly phase
+
+	long bytesUsed();	// See ds/memory.h
+	long bytesReserved();
+};
+
+#include "../../src/flatsets/FlatSortedSet.cpp"
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef GRAPHS_H
+#define GRAPHS_H
+
+#include "./interfaces/graph.h"
+#include "./interfaces/list.h"
+#include "./array.h"
+#include "./array_lists.h"
+
+/**
+* Every graph also provides forEachOutEdge(i, f), which calls f(j, w)
+* for each edge i->j of weight w without building a list. The traversals
+* below work on any class with that method and nVertices().
+*
+* For bytesUsed() (see ds/memory.h) an edge is the int naming its
+* target, and its weight too in CSRGraph, which stores one.
+*/
+
+class AdjacencyMatrix: public IGraph {
+	int n;
+	int m = 0;
+	Array<char> a;	// a[i*n + j] is 1 if there is an edge i->j
+
+	void check(int i, int j);
+
+public:
+	AdjacencyMatrix(int _n);
+	AdjacencyMatrix(const AdjacencyMatrix&) = delete;
+	AdjacencyMatrix& operator=(const AdjacencyMatrix&) = delete;
+
+	int nVertices();
+	void addEdge(int i, int j);
+	void removeEdge(int i, int j);
+	bool hasEdge(int i, int j);
+	void outEdges(int i, IList<int> &edges);
+	void inEdges(int i, IList<int> &edges);
+
+	template <class F>
+	void forEachOutEdge(int i, F f);
+
+	long bytesUsed();
+	long bytesReserved();
+};
+
+
+class AdjacencyLists: public IGraph {
+	int n;
+	Array<ArrayStack<int> > adj;	// adj[i] lists the j with an edge i->j
+
+public:
+	AdjacencyLists(int _n);
+	AdjacencyLists(const AdjacencyLists&) = delete;
+	AdjacencyLists& operator=(const AdjacencyLists&) = delete;
+
+	int nVertices();
+	void addEdge(int i, int j);
+	void removeEdge(int i, int j);
+	bool hasEdge(int i, int j);
+	void outEdges(int i, IList<int> &edges);
+	void inEdges(int i, IList<int> &edges);
+
+	template <class F>
+	void forEachOutEdge(int i, F f);
+
+	long bytesUsed();
+	long bytesReserved();
+};
+
+
+/**
+* Compressed sparse row graph. Edges can't be added or removed once
+* it is built, so it doesn't implement IGraph.
+*/
+class CSRGraph {
+	int n;
+	int m;
+	Array<int> outStart;	// The edges from i are at outStart[i], ..., outStart[i+1]-1
+	Array<int> outTarget;
+	Array<int> outWeight;
+	Array<int> inStart;	// The edges to i are at inStart[i], ..., inStart[i+1]-1
+	Array<int> inSource;
+	Array<int> inWeight;
+
+	void build(const int* sources, const int* targets, const int* weights);
+
+public:
+	CSRGraph(int _n, int _m, const int* sources, const int* targets, const int* weights = nullptr);
+	CSRGraph(const CSRGraph&) = delete;
+	CSRGraph& operator=(const CSRGraph&) = delete;
+
+	template <class Graph>
+	explicit CSRGraph(Graph &g);	// Copies the edges of any graph with forEachOutEdge
+
+	int nVertices();
+	int nEdges();
+	bool hasEdge(int i, int j);
+
+	// Direct access to the contiguous edge arrays
+	int outDegree(int i);
+	const int* outTargets(int i);
+	int inDegree(int i);
+	const int* inSources(int i);
+
+	template <class F>
+	void forEachOutEdge(int i, F f);
+	template <class F>
+	void forEachInEdge(int i, F f);
+
+	long bytesUsed();
+	long bytesReserved();
+};
+
+
+// Traversals from r. Unreachable vertices get a distance of -1.
+template <class Graph> void bfs(Graph &g, int r, int* dist);	// Distances in edges
+template <class Graph> int dfs(Graph &g, int r, int* order);	// Fills order with the vertices reached, returns how many
+template <class Graph> void dijkstra(Graph &g, int r, long* dist);	// Weights must not be negative
+inline void parallelBFS(CSRGraph &g, int r, int* dist);
+
+#include "../../src/graphs/AdjacencyMatrix.cpp"
+#include "../../src/graphs/AdjacencyLists.cpp"
+#include "../../src/graphs/CSRGraph.cpp"
+#include "../../src/graphs/Traversals.cpp"
+#include "../../src/graphs/ParallelBFS.cpp"
+
+#endif
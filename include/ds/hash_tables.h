@@ -0,0 +1,169 @@
+#ifndef HASH_TABLES_H
+#define HASH_TABLES_H
+
+#include "./interfaces/uset.h"
+#include "./array.h"
+#include "./array_lists.h"
+#include "./memory.h"
+
+template <class T>
+class ChainedHashTable : public IUSet<T> {
+	Array<ArrayStack<T> > t;
+	int n = 0;
+	int d = 1;	// t.length() is 2^d
+	unsigned z;	// Random odd multiplier
+
+	unsigned hash(const T& x);
+	void resize();
+
+public:
+	ChainedHashTable();
+	ChainedHashTable(const ChainedHashTable<T>&) = delete;
+	ChainedHashTable<T>& operator=(const ChainedHashTable<T>&) = delete;
+
+	int size();
+	bool add(T x);
+	T remove(T x);
+	T find(const T& x);
+	bool contains(const T& x);
+
+	long bytesUsed();	// See ds/memory.h
+	long bytesReserved();
+};
+
+
+template <class T>
+class LinearHashTable : public IUSet<T> {
+	Array<T> t;
+	Array<char> state;	// empty, full or deleted, for each slot of t
+	int n = 0;	// Number of elements
+	int q = 0;	// Number of full and deleted slots
+	int d = 1;
+	unsigned z;
+
+	static const char empty = 0;
+	static const char full = 1;
+	static const char deleted = 2;
+
+	unsigned hash(const T& x);
+	void resize();
+
+public:
+	LinearHashTable();
+	LinearHashTable(const LinearHashTable<T>&) = delete;
+	LinearHashTable<T>& operator=(const LinearHashTable<T>&) = delete;
+
+	int size();
+	bool add(T x);
+	T remove(T x);
+	T find(const T& x);
+	bool contains(const T& x);
+
+	long bytesUsed();
+	long bytesReserved();
+};
+
+
+template <class K>
+class SetEntry {
+public:
+	K key;
+};
+
+template <class K, class V>
+class MapEntry {
+public:
+	K key;
+	V value;
+};
+
+
+/**
+* Open addressing table with one metadata byte per slot, probed 16
+* slots at a time. Shared by SwissHashSet and SwissHashMap; E is the
+* entry type stored in each slot and must have a key member.
+*/
+template <class K, class E>
+class SwissTable {
+	struct Table {
+		unsigned char* ctrl;	// cap metadata bytes, then copies of the first groupWidth-1
+		E* slots;
+		int cap;	// Power of 2, at least groupWidth
+	};
+
+	Table t;	// All new entries go here
+	Table old;	// Being drained into t during a resize, old.ctrl is nullptr otherwise
+	int migrated = 0;	// Next slot of old to move to t
+	int n = 0;	// Entries in both tables
+	int tn = 0;	// Entries in t
+
+	static const int groupWidth = 16;
+	static const int migrateBatch = 32;
+	static const unsigned char empty = 0x80;
+	static const unsigned char moved = 0xFE;
+
+	static size_t hash(const K &k);
+	static unsigned match(const unsigned char* group, unsigned char b);
+	static Table allocate(int cap);
+	static void release(Table &tb);
+	static void setCtrl(Table &tb, int i, unsigned char c);
+	static E* probe(Table &tb, const K &k, size_t h, int &index);
+	static int emptySlot(Table &tb, size_t h);
+
+	void grow();
+	void migrateStep();
+	void backwardShift(int i);
+
+public:
+	SwissTable();
+	SwissTable(const SwissTable<K, E>&) = delete;
+	SwissTable<K, E>& operator=(const SwissTable<K, E>&) = delete;
+	~SwissTable();
+
+	int size();
+	E* lookup(const K &k);	// nullptr if k is not present
+	E* insert(K &&k, bool &added);	// Moves k into a new entry
+	bool erase(const K &k);
+	long bytesReserved();	// Both tables while a resize is in progress
+};
+
+
+template <class T>
+class SwissHashSet : public IUSet<T> {
+	SwissTable<T, SetEntry<T> > table;
+
+public:
+	int size();
+	bool add(T x);
+	T remove(T x);
+	T find(const T& x);
+	bool contains(const T& x);
+
+	long bytesUsed();
+	long bytesReserved();
+};
+
+
+template <class K, class V>
+class SwissHashMap {
+	SwissTable<K, MapEntry<K, V> > table;
+
+public:
+	int size();
+	bool put(K k, V v);	// Returns true if k was not already present
+	V get(K k);
+	V* lookup(K k);	// Pointer to the value, or nullptr. Invalidated by put or remove
+	bool contains(K k);
+	V remove(K k);
+
+	long bytesUsed();
+	long bytesReserved();
+};
+
+#include "../../src/hashtables/ChainedHashTable.cpp"
+#include "../../src/hashtables/LinearHashTable.cpp"
+#include "../../src/hashtables/SwissTable.cpp"
+#include "../../src/hashtables/SwissHashSet.cpp"
+#include "../../src/hashtables/SwissHashMap.cpp"
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef HEAPS_H
+#define HEAPS_H
+
+#include "./interfaces/priorityqueue.h"
+#include "./array.h"
+#include "./binary_trees.h"
+#include "./memory.h"
+
+/**
+* Array-backed heap where each node has D children.
+* The default of 4 children keeps each group of siblings
+* within a single cache line.
+*/
+template <class T, int D = 4>
+class BinaryHeap : public IPriorityQueue<T> {
+	Array<T> a;
+	int n = 0;
+	ShrinkPolicy policy;
+
+	static const int offset = D - 1;	// Leading unused slots, so sibling groups start at multiples of D
+
+	void resize(int length);
+	void bubbleUp(T* h, int i);
+	void trickleDown(T* h, int i);
+
+public:
+	BinaryHeap() {}
+	BinaryHeap(const BinaryHeap<T, D>&) = delete;
+	BinaryHeap<T, D>& operator=(const BinaryHeap<T, D>&) = delete;
+
+	int size();
+	void add(T x);
+	T remove();
+	T peek();
+	void addAll(const T* xs, int m);
+
+	// Capacity control, see ShrinkPolicy in ds/array.h
+	int capacity();
+	void reserve(int m);
+	void shrinkToFit();
+	ShrinkPolicy shrinkPolicy();
+	void setShrinkPolicy(ShrinkPolicy p);
+
+	long bytesUsed();	// See ds/memory.h
+	long bytesReserved();
+};
+
+
+template <class T>
+class MeldableHeap : public IPriorityQueue<T> {
+	BTNode<T>* root;
+	int n;
+
+	static BTNode<T>* merge(BTNode<T>* h1, BTNode<T>* h2);
+
+public:
+	MeldableHeap(): root(nullptr), n(0) {}
+	MeldableHeap(const MeldableHeap<T>&) = delete;
+	MeldableHeap<T>& operator=(const MeldableHeap<T>&) = delete;
+	~MeldableHeap();
+
+	int size();
+	void add(T x);
+	T remove();
+	T peek();
+	void meld(MeldableHeap<T> &b);
+
+	long bytesUsed();
+	long bytesReserved();
+};
+
+#include "../../src/heaps/BinaryHeap.cpp"
+#include "../../src/heaps/MeldableHeap.cpp"
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+* Counters for the internal work done by the containers.
+*
+* Instrumentation is off by default and costs nothing: the containers
+* derive from Counters<false>, which is empty (so takes no space) and
+* whose methods do nothing.
+* Compile with -DDS_INSTRUMENT=1 to turn it on for every container, or
+* specialize Instrumented for one container type before including its
+* header:
+*
+*   #include "ds/instrument.h"
+*   template <class T> class Treap;
+*   template <class T> struct Instrumented<Treap<T> > { static const bool value = true; };
+*   #include "ds/binary_trees.h"
+*
+* ArrayDeque is built on ArrayQueue and shares its switch.
+*
+* Each container's stats() returns its own counts. Instrumented
+* containers also register with InstrumentRegistry, which totals the
+* counts by container name and can dump them as JSON.
+*/
+
+#ifndef DS_INSTRUMENT
+#define DS_INSTRUMENT 0
+#endif
+
+struct OpStats {
+	long resizes = 0;	// Backing array reallocated
+	long copies = 0;	// Elements copied into a new backing array
+	long shifts = 0;	// Elements moved along to open or close a gap
+	long balances = 0;	// Redistributions between two halves, their elements count as copies
+	long rotations = 0;	// Tree rotations
+	long steps = 0;	// Links followed to reach a position
+
+	OpStats& operator+=(const OpStats &b);
+};
+
+
+template <class Container>
+struct Instrumented {
+	static const bool value = DS_INSTRUMENT;
+};
+
+
+template <bool enabled>
+class Counters;
+
+template <>
+class Counters<false> {
+public:
+	Counters(const char*) {}
+
+	void resized(long) {}
+	void shifted(long) {}
+	void balanced(long) {}
+	void rotated() {}
+	void stepped(long) {}
+	OpStats counts() const { return OpStats(); }
+};
+
+/**
+* Copying a container gives the copy fresh counts. Assigning one leaves
+* the counts of the container assigned to unchanged.
+*/
+template <>
+class Counters<true> {
+	friend class InstrumentRegistry;
+
+	const char* name;
+	OpStats s;
+	Counters<true>* prev;	// Registry's list of live counters
+	Counters<true>* next;
+
+public:
+	Counters(const char* _name);
+	Counters(const Counters<true> &b);
+	Counters<true>& operator=(const Counters<true>&) { return *this; }
+	~Counters();
+
+	void resized(long copied) { s.resizes++; s.copies += copied; }
+	void shifted(long k) { s.shifts += k; }
+	void balanced(long moved) { s.balances++; s.copies += moved; }
+	void rotated() { s.rotations++; }
+	void stepped(long k) { s.steps += k; }
+	OpStats counts() const { return s; }
+};
+
+
+class InstrumentRegistry {
+public:
+	struct Totals {
+		const char* name;
+		long instances;	// Created since the last reset, live or not
+		long live;
+		OpStats stats;
+	};
+
+private:
+	std::mutex lock;
+	Counters<true>* live = nullptr;
+	std::vector<Totals> retired;	// Counts of destroyed containers, by name
+
+	InstrumentRegistry() {}
+	static Totals& find(std::vector<Totals> &totals, const char* name);
+
+public:
+	static InstrumentRegistry& instance();
+
+	void add(Counters<true>* c);
+	void remove(Counters<true>* c);
+
+	// Only consistent while no instrumented container is being modified
+	std::vector<Totals> totals();
+	std::string toJSON();
+	void reset();
+};
+
+#include "../../src/instrument/Instrumentation.cpp"
+
+#endif
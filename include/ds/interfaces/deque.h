@@ -1,6 +1,8 @@
 #ifndef I_DEQUE_H
 #define I_DEQUE_H
 
+#include <utility>
+
 #include "./queue.h"
 #include "./stack.h"
 
@@ -16,6 +18,11 @@ public:
 	virtual T removeFirst() = 0;
 	virtual void addLast(T x) = 0;
 	virtual T removeLast() = 0;
+
+	template <class... Args>
+	void emplaceFirst(Args&&... args) { addFirst(T(std::forward<Args>(args)...)); }
+	template <class... Args>
+	void emplaceLast(Args&&... args) { addLast(T(std::forward<Args>(args)...)); }
 };
 
 #endif
@@ -0,0 +1,26 @@
+#ifndef I_GRAPH_H
+#define I_GRAPH_H
+
+#include "./list.h"
+
+/**
+* Directed graph on the vertices 0, ..., nVertices()-1.
+*
+* outEdges(i, edges) adds every j with an edge i->j to the end of
+* edges, and inEdges(i, edges) every j with an edge j->i.
+*/
+class IGraph {
+public:
+	virtual ~IGraph() {}
+
+	// Pure virtual methods.
+	// Must be defined in implementing classes
+	virtual int nVertices() = 0;
+	virtual void addEdge(int i, int j) = 0;
+	virtual void removeEdge(int i, int j) = 0;
+	virtual bool hasEdge(int i, int j) = 0;
+	virtual void outEdges(int i, IList<int> &edges) = 0;
+	virtual void inEdges(int i, IList<int> &edges) = 0;
+};
+
+#endif
@@ -1,6 +1,15 @@
 #ifndef I_LIST_H
 #define I_LIST_H
 
+#include <utility>
+
+/**
+* Elements are passed in by value and moved into place, so callers
+* that pass a temporary or std::move(x) never copy it. get() returns
+* a reference into the list, valid until the list is next modified,
+* and remove() moves the element out.
+*/
+
 template <class T>
 class IList {
 public:
@@ -9,10 +18,14 @@ public:
 	// Pure virtual methods.
 	// Must be defined in implementing classes
 	virtual int size() = 0;
-	virtual T get(int i) = 0;
+	virtual const T& get(int i) = 0;
     virtual T set(int i, T x) = 0;
 	virtual void add(int i, T x) = 0;
 	virtual T remove(int i) = 0;
+
+	// Construct the element from args and move it in at i
+	template <class... Args>
+	void emplace(int i, Args&&... args) { add(i, T(std::forward<Args>(args)...)); }
 };
 
 #endif
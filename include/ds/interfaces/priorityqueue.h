@@ -0,0 +1,25 @@
+#ifndef I_PRIORITY_QUEUE_H
+#define I_PRIORITY_QUEUE_H
+
+/**
+* Priority queue.
+*
+* remove() always returns the smallest element, regardless of the
+* order in which elements were added. peek() returns it without
+* removing it. Both throw std::out_of_range if the queue is empty.
+*/
+
+template <class T>
+class IPriorityQueue {
+public:
+	virtual ~IPriorityQueue() {}
+
+	// Pure virtual methods.
+	// Must be defined in implementing classes
+	virtual int size() = 0;
+	virtual void add(T x) = 0;
+	virtual T remove() = 0;
+	virtual T peek() = 0;
+};
+
+#endif
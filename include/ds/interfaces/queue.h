@@ -1,6 +1,8 @@
 #ifndef I_QUEUE_H
 #define I_QUEUE_H
 
+#include <utility>
+
 /**
 * FIFO queue.
 *
@@ -17,8 +19,11 @@ public:
 	// Pure virtual methods.
 	// Must be defined in implementing classes
 	virtual int size() = 0;
-	virtual void enqueue(T x) = 0;
-	virtual T dequeue() = 0;
+	virtual void enqueue(T x) = 0;	// Moves x in
+	virtual T dequeue() = 0;	// Moves the element out
+
+	template <class... Args>
+	void emplaceEnqueue(Args&&... args) { enqueue(T(std::forward<Args>(args)...)); }
 };
 
 #endif
@@ -1,6 +1,13 @@
 #ifndef I_SORTED_SET_H
 #define I_SORTED_SET_H
 
+#include <utility>
+
+/**
+* add() moves x into the set. find() only compares x, so takes it by
+* reference, and returns a copy of the value it finds.
+*/
+
 template <class T>
 class ISortedSet {
 public:
@@ -11,7 +18,10 @@ public:
 	virtual int size() = 0;
 	virtual bool add(T x) = 0;
 	virtual T remove(T x) = 0;
-	virtual T find(T x) = 0;
+	virtual T find(const T& x) = 0;
+
+	template <class... Args>
+	bool emplace(Args&&... args) { return add(T(std::forward<Args>(args)...)); }
 };
 
 #endif
@@ -1,6 +1,8 @@
 #ifndef I_STACK_H
 #define I_STACK_H
 
+#include <utility>
+
 template <class T>
 class IStack {
 public:
@@ -9,8 +11,11 @@ public:
 	// Pure virtual methods.
 	// Must be defined in implementing classes
 	virtual int size() = 0;
-	virtual void push(T x) = 0;
-	virtual T pop() = 0;
+	virtual void push(T x) = 0;	// Moves x in
+	virtual T pop() = 0;	// Moves the element out
+
+	template <class... Args>
+	void emplacePush(Args&&... args) { push(T(std::forward<Args>(args)...)); }
 };
 
 #endif
@@ -0,0 +1,28 @@
+#ifndef I_USET_H
+#define I_USET_H
+
+/**
+* Unordered set.
+*
+* Elements are only compared for equality, so there is no notion of
+* a successor as there is for ISortedSet. remove(x) and find(x) throw
+* std::out_of_range if x is not in the set.
+*
+* As in ISortedSet, add() moves x into the set, and find() only
+* compares x, so takes it by reference.
+*/
+
+template <class T>
+class IUSet {
+public:
+	virtual ~IUSet() {}
+
+	// Pure virtual methods.
+	// Must be defined in implementing classes
+	virtual int size() = 0;
+	virtual bool add(T x) = 0;
+	virtual T remove(T x) = 0;
+	virtual T find(const T& x) = 0;	// return the element equal to x
+};
+
+#endif
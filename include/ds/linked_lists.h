@@ -5,6 +5,8 @@
 #include "./interfaces/list.h"
 #include "./interfaces/queue.h"
 #include "./interfaces/stack.h"
+#include "./instrument.h"
+#include "./memory.h"
 #include "./node.h"
 
 template <class T>
@@ -14,6 +16,11 @@ class SLList: public IStack<T>, public IQueue<T>{
 	int n = 0;
 
 public:
+	SLList() {}
+	SLList(const SLList<T>&) = delete;
+	SLList<T>& operator=(const SLList<T>&) = delete;
+	~SLList();
+
 	int size();
 
 	// Stack methods: last in, first out
@@ -23,22 +30,27 @@ public:
 	// Queue methods: first in, first out
 	void enqueue(T x);	// Add at tail
 	T dequeue();		// Same as pop, remove from head
+
+	long bytesUsed();	// See ds/memory.h
+	long bytesReserved();
 };
 
 
 template <class T>
-class DLList: public IDeque<T>, public IStack<T>, public IQueue<T>, public IList<T>{
+class DLList: public IDeque<T>, public IStack<T>, public IQueue<T>, public IList<T>, Counters<Instrumented<DLList<T> >::value> {
 	DNode<T> dummy;
 	int n = 0;
 
 	DNode<T>* getNode(int i);
-	DNode<T>* addBefore(DNode<T> *w, T x);
 
 public:
 	DLList();
+	DLList(const DLList<T>&) = delete;
+	DLList<T>& operator=(const DLList<T>&) = delete;
+	~DLList();
 
 	int size();
-	T get(int i);
+	const T& get(int i);
 	T set(int i, T x);
 	void add(int i, T x);
 	T remove(int i);
@@ -53,6 +65,16 @@ public:
 
 	void enqueue(T x);
 	T dequeue();
+
+	// Node handles stay valid until their node is removed
+	DNode<T>* end();	// The dummy node, next is the first node and prev the last
+	DNode<T>* addBefore(DNode<T> *w, T x);
+	void moveBefore(DNode<T> *u, DNode<T> *w);
+	T removeNode(DNode<T> *u);
+
+	OpStats stats();	// All zero unless instrumented, see ds/instrument.h
+	long bytesUsed();
+	long bytesReserved();
 };
 
 #include "../../src/linkedlists/SLList.cpp"
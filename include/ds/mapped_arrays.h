@@ -0,0 +1,91 @@
+#ifndef MAPPED_ARRAYS_H
+#define MAPPED_ARRAYS_H
+
+#include "./memory.h"
+#include "./snapshots.h"
+
+/**
+* Arrays kept in a memory-mapped file rather than on the heap, so they
+* can be larger than RAM and outlive the process. The file is a list
+* snapshot (see ds/snapshots.h) with room for more elements after the
+* n in use, so it can also be opened with a ListView.
+*
+* Lengths and indices are longs, since files of more than 2^31
+* elements are the point. T must be trivially copyable, and no more
+* than 32 bytes aligned.
+*/
+
+template <class T>
+class MappedArray {
+	int fd = -1;
+	char* p = nullptr;	// The mapping, SnapshotHeader first
+	long l = 0;	// Capacity in elements
+	int hint;	// madvise() advice, reapplied after every resize
+
+	size_t fileBytes(long len);
+	void advise(int advice);
+
+public:
+	MappedArray(const char* path, long len = 1);	// Opens or creates path, with room for at least len elements
+	MappedArray(const MappedArray<T>&) = delete;
+	MappedArray<T>& operator=(const MappedArray<T>&) = delete;
+	~MappedArray();
+
+	T& operator[](long i);
+	T* data();
+	long length();
+	void resize(long len);	// Grows or shrinks the file, keeping the first len elements
+
+	long used();	// The n in the file's header
+	void setUsed(long n);
+
+	// Hints for the page cache, see madvise(2)
+	void adviseNormal();
+	void adviseSequential();
+	void adviseRandom();
+	void willNeed(long i, long j);	// Start reading elements i..j-1 in the background
+
+	void sync();	// Returns once every change has reached the disk
+};
+
+
+/**
+* An ArrayStack whose backing array is a MappedArray. It takes long
+* indices, so it can't implement IList, but has the same methods.
+*/
+template <class T>
+class MappedArrayStack {
+	MappedArray<T> a;
+	long n;
+	ShrinkPolicy policy;
+
+public:
+	MappedArrayStack(const char* path);	// Opens path, keeping any elements already in it
+
+	long size();
+	T get(long i);
+	T set(long i, T x);
+	void add(long i, T x);
+	T remove(long i);
+
+	void push(T x);
+	T pop();
+
+	long capacity();
+	void reserve(long m);
+	void shrinkToFit();
+	ShrinkPolicy shrinkPolicy();
+	void setShrinkPolicy(ShrinkPolicy p);
+
+	void adviseSequential();
+	void adviseRandom();
+	void sync();
+
+	long bytesUsed();	// See ds/memory.h
+	long bytesReserved();
+};
+
+#include "../../src/mappedarrays/MappedArray.cpp"
+#include "../../src/mappedarrays/MappedArrayStack.cpp"
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+/**
+* Memory accounting.
+*
+* Every container reports
+*   bytesUsed():      bytes taken by the elements themselves, eg n * sizeof(T)
+*   bytesReserved():  bytes the container has allocated for them, including
+*                     unused array slots, node links and table metadata
+*
+* and overheadRatio(c) below gives bytesReserved() / bytesUsed() for any
+* of them, 1 meaning no overhead and 0 for an empty container.
+*
+* Neither count includes the container object itself, or memory owned
+* by the elements (eg the characters of a std::string).
+*
+* For a process-wide count of everything allocated with new, define
+* DS_TRACK_ALLOCATIONS before including this header in exactly one
+* translation unit (usually the one with main). That replaces the
+* global operator new and delete with versions that update
+* MemoryTally::instance().
+*/
+
+template <class Container>
+double overheadRatio(Container &c){
+	long used = c.bytesUsed();
+	return (used == 0) ? 0 : (double)c.bytesReserved() / used;
+}
+
+
+class MemoryTally {
+	std::atomic<long> current;
+	std::atomic<long> highest;
+	std::atomic<long> allocated;
+	std::atomic<long> freed;
+
+	constexpr MemoryTally(): current(0), highest(0), allocated(0), freed(0) {}
+
+public:
+	static MemoryTally& instance();
+
+	void allocate(size_t bytes);
+	void release(size_t bytes);
+
+	bool tracking();	// Whether DS_TRACK_ALLOCATIONS is defined somewhere in the program
+	long bytes();	// Allocated and not yet freed
+	long peak();	// Highest value of bytes() since the last resetPeak()
+	long allocations();
+	long frees();
+	void resetPeak();
+};
+
+#include "../../src/memory/MemoryTally.cpp"
+
+#endif
@@ -1,13 +1,15 @@
 #ifndef NODE_H
 #define NODE_H
 
+#include <utility>
+
 template <class T>
 class Node {
 public:
 	T x;
 	Node<T>* next;
 
-	Node(T _x): x(_x), next(nullptr){}
+	Node(T _x): x(std::move(_x)), next(nullptr){}
 };
 
 
@@ -18,7 +20,7 @@ public:
 	DNode<T>* next;
 	DNode<T>* prev;
 
-	DNode(T _x): x(_x), next(nullptr), prev(nullptr){}
+	DNode(T _x): x(std::move(_x)), next(nullptr), prev(nullptr){}
 };
 
 #endif
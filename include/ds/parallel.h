@@ -0,0 +1,41 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <vector>
+
+#include "./concurrency.h"
+
+/**
+* Parallel algorithms over a random access range a[0..n-1], where a is
+* a pointer or an iterator such as std::reverse_iterator<T*>.
+*
+* The array based lists run these over their backing storage, eg
+*   ArrayStack<int> as;
+*   ...
+*   as.transform([](int x){ return 2*x; });
+*   long total = as.reduce(0L, [](long s, long x){ return s + x; });
+*
+* The range is cut into chunks, one per task of forkEach(), and the
+* cuts are moved to cache line boundaries so that no two tasks write
+* to the same line. Short ranges run on the calling thread.
+*
+* The functions are called concurrently from several threads and must
+* not throw. Neither reduce nor inclusiveScan reorder the elements, so
+* op only has to be associative, not commutative. reduce converts the
+* elements to the type of init, and op combines two values of that
+* type, eg partial sums from two chunks.
+*/
+
+template <class It, class F> void parallelForEach(It a, int n, F f);	// f(a[i]) for every i
+template <class It, class F> void parallelTransform(It a, int n, F f);	// a[i] = f(a[i])
+template <class It, class T, class Op> T parallelReduce(It a, int n, T init, Op op);	// init op a[0] op ... op a[n-1]
+template <class It, class Op> void parallelInclusiveScan(It a, int n, Op op);	// a[i] = a[0] op ... op a[i]
+template <class It, class T, class Op> void parallelInclusiveScan(It a, int n, Op op, T init);	// a[i] = init op a[0] op ... op a[i]
+
+// Building blocks for the algorithms above
+template <class It> std::vector<int> chunkBounds(It a, int n, int tasks);
+template <class It> bool onLineBoundary(It a, int i);
+
+#include "../../src/parallel/ParallelAlgorithms.cpp"
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef SCANS_H
+#define SCANS_H
+
+#include <type_traits>
+
+/**
+* Linear scans over a contiguous range a[0..n-1].
+*
+* The array based lists run these over their backing storage, eg
+*   ArrayStack<int> as;
+*   ...
+*   as.indexOf(42);
+* rather than calling get(i) once per element, which costs a virtual
+* call and a bounds check each time and can't be vectorized.
+*
+* The templates work for any type with == and <. int and double have
+* SIMD versions using AVX2 or SSE (see src/scans/SimdScans.cpp) when
+* the compiler is allowed to use them, eg with -mavx2 or -march=native.
+*/
+
+template <class T, bool arithmetic = std::is_arithmetic<T>::value>
+struct ScanSum {
+	typedef T type;
+};
+
+template <class T>
+struct ScanSum<T, true> {
+	typedef decltype(T() + 0L) type;	// Sums of ints are longs, so they don't overflow
+};
+
+template <class T> int scanIndexOf(const T* a, int n, const T& x);	// First i with a[i] == x, or -1
+template <class T> int scanCount(const T* a, int n, const T& x);	// Number of i with a[i] == x
+template <class T> T scanMin(const T* a, int n);	// n must be at least 1
+template <class T> T scanMax(const T* a, int n);
+template <class T> typename ScanSum<T>::type scanSum(const T* a, int n);
+
+// Element at a time versions, used by the templates above
+// and for the leftovers at the end of the SIMD versions
+template <class T> int scalarIndexOf(const T* a, int n, const T& x);
+template <class T> int scalarCount(const T* a, int n, const T& x);
+template <class T> T scalarMin(const T* a, int n);
+template <class T> T scalarMax(const T* a, int n);
+template <class T> typename ScanSum<T>::type scalarSum(const T* a, int n);
+
+#include "../../src/scans/Scans.cpp"
+#include "../../src/scans/SimdScans.cpp"
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef SKIPLISTS_H
+#define SKIPLISTS_H
+
+#include <atomic>
+#include <mutex>
+
+#include "./interfaces/sortedset.h"
+#include "./concurrency.h"
+#include "./memory.h"
+
+template <class T>
+class SkiplistNode {
+public:
+	T x;
+	int height;	// Index of the highest list this node belongs to
+	std::mutex lock;
+	std::atomic<bool> marked;	// Logically removed
+	std::atomic<bool> fullyLinked;	// Linked into every list up to height
+	std::atomic<SkiplistNode<T>*>* next;	// height+1 pointers, stored after the node
+
+	static SkiplistNode<T>* create(T x, int height);
+	static void destroy(void* u);
+
+private:
+	SkiplistNode(T _x, int _height): x(_x), height(_height), marked(false), fullyLinked(false) {}
+};
+
+
+/**
+* Thread-safe sorted set. add() and remove() lock only the nodes they
+* modify; find() and size() take no locks at all.
+*/
+template <class T>
+class ConcurrentSkiplistSSet: public ISortedSet<T> {
+	static const int maxHeight = 32;
+
+	SkiplistNode<T>* sentinel;
+	std::atomic<int> n;
+	std::atomic<int> h;	// Height of the tallest node added so far
+
+	int pickHeight();
+	int findPredecessors(T x, SkiplistNode<T>** preds, SkiplistNode<T>** succs);
+	void unlock(SkiplistNode<T>** preds, int highestLocked);
+
+public:
+	ConcurrentSkiplistSSet();
+	~ConcurrentSkiplistSSet();
+
+	int size();
+	bool add(T x);
+	T remove(T x);
+	T find(const T& x);	// return smallest element that is greater than or equal to x
+	bool contains(T x);
+
+	long bytesUsed();	// See ds/memory.h
+	long bytesReserved();
+};
+
+#include "../../src/skiplists/ConcurrentSkiplistSSet.cpp"
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef SNAPSHOTS_H
+#define SNAPSHOTS_H
+
+#include <cstddef>
+
+#include "./interfaces/list.h"
+#include "./array.h"
+#include "./linked_lists.h"
+
+/**
+* Binary snapshots of lists and sorted sets, read back through mmap.
+* Elements are stored as raw bytes, so T must be trivially copyable,
+* and a file can only be read on a machine with the same byte order.
+*/
+
+struct SnapshotHeader {
+	char magic[8];	// "ODSSNAP", null terminated
+	unsigned int version;
+	unsigned int layout;	// How the elements are arranged, see below
+	unsigned int elementSize;	// sizeof(T) when written
+	unsigned int byteOrder;	// 0x01020304 as written by the saving machine
+	unsigned long long n;
+};
+
+static const unsigned int snapshotVersion = 1;
+static const unsigned int contiguousLayout = 1;	// Elements in list order
+static const unsigned int eytzingerLayout = 2;	// Sorted elements in breadth-first tree order
+
+
+/**
+* Read-only memory mapping of a whole file.
+*/
+class MappedFile {
+	const char* p = nullptr;
+	size_t len = 0;
+
+public:
+	MappedFile() {}
+	MappedFile(const char* path);
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile();
+
+	const char* data();
+	size_t length();
+};
+
+
+template <class T>
+class ListView {
+	MappedFile file;
+	const T* a;
+	long n;
+
+public:
+	ListView(const char* path);
+
+	long size();
+	T get(long i);
+	const T* data();	// The elements, in order
+	const T* begin() { return a; }
+	const T* end() { return a + n; }
+};
+
+
+template <class T>
+class SortedSetView {
+	MappedFile file;
+	const T* b;	// b[1..n] in Eytzinger order, b[0] is unused
+	long n;
+
+public:
+	SortedSetView(const char* path);
+
+	long size();
+	T find(T x);	// Smallest value >= x, throws if there is none
+	bool contains(T x);
+};
+
+
+template <class T>
+void saveList(IList<T> &list, const char* path);
+template <class T>
+void saveList(DLList<T> &list, const char* path);	// Walks the nodes, since get(i) is O(n) there
+template <class Set>
+void saveSortedSet(Set &set, const char* path);	// Set is one of the BinarySearchTrees
+
+#include "../../src/snapshots/MappedFile.cpp"
+#include "../../src/snapshots/ListSnapshot.cpp"
+#include "../../src/snapshots/SortedSetSnapshot.cpp"
+
+#endif
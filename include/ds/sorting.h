@@ -0,0 +1,39 @@
+#ifndef SORTING_H
+#define SORTING_H
+
+#include "./array.h"
+#include "./concurrency.h"
+
+/**
+* Sorting algorithms over a contiguous range a[0..n-1].
+*
+* The array based lists sort their backing storage directly by passing
+* one of these to their sort() method, eg
+*   ArrayStack<int> as;
+*   ...
+*   as.sort(mergeSort<int>);
+*/
+
+// Comparison sorts, ordering elements with <
+template <class T> void mergeSort(T* a, int n);	// Stable
+template <class T> void parallelMergeSort(T* a, int n);	// Stable
+template <class T> void quickSort(T* a, int n);
+
+// Integer sorts
+template <class T> void countingSort(T* a, int n, int k);	// Every element must be in [0, k)
+template <class T> void radixSort(T* a, int n);	// T must be an integral type
+template <class T> void parallelRadixSort(T* a, int n);
+
+// Building blocks for the sorts above
+template <class T> void insertionSort(T* a, int n);
+template <class T> void merge(T* x, int nx, T* y, int ny, T* out);
+template <class T> void parallelMerge(T* x, int nx, T* y, int ny, T* out, int depth);
+template <class T> void mergeSortInPlace(T* a, T* tmp, int n, int depth);
+template <class T> void mergeSortInto(T* a, T* dst, int n, int depth);
+template <class T> int radixDigit(T x, int shift);
+
+#include "../../src/sorting/MergeSort.cpp"
+#include "../../src/sorting/QuickSort.cpp"
+#include "../../src/sorting/RadixSort.cpp"
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef TRIES_H
+#define TRIES_H
+
+#include <type_traits>
+
+#include "./interfaces/sortedset.h"
+#include "./array.h"
+#include "./binary_trees.h"
+#include "./hash_tables.h"
+#include "./memory.h"
+
+template <class T>
+class BinaryTrieNode {
+public:
+	T x;	// Only set in leaves
+	BinaryTrieNode<T>* child[2];	// In leaves, the previous and next leaf
+	BinaryTrieNode<T>* jump;	// In nodes with one child, the nearest leaf on the missing side
+	BinaryTrieNode<T>* parent;
+
+	BinaryTrieNode(): x(0), jump(nullptr), parent(nullptr) {
+		child[0] = nullptr;
+		child[1] = nullptr;
+	}
+};
+
+
+/**
+* Sorted set of unsigned integers, stored by their bits
+* from the most significant down. N can be a subclass of
+* BinaryTrieNode, to attach extra data to the leaves.
+*/
+template <class T, class N = BinaryTrieNode<T> >
+class BinaryTrie: public ISortedSet<T> {
+	static_assert(std::is_unsigned<T>::value, "BinaryTrie keys must be unsigned integers");
+
+protected:
+	typedef BinaryTrieNode<T> Node;
+	static const int w = 8 * sizeof(T);	// Bits per key, and depth of the leaves
+	static const int prev = 0;
+	static const int next = 1;
+
+	N root;
+	N dummy;	// Before the first and after the last leaf
+	int n;
+
+	static int bit(T x, int i);	// Bit of x at depth i, counting from the most significant
+	virtual Node* deepestPrefix(T x, int &i);	// Deepest node on the path to x, and its depth i
+	Node* successorLeaf(Node* u, int i, T x);
+	N* addLeaf(T x);	// nullptr if x is already present
+	int removeLeaf(T x);	// Depth of the deepest node left on the path to x
+	void deleteNodes(Node* u, int depth);
+	long countNodes(Node* u, int depth);
+
+public:
+	BinaryTrie();
+	BinaryTrie(const BinaryTrie<T, N>&) = delete;	// The trie owns its nodes
+	BinaryTrie<T, N>& operator=(const BinaryTrie<T, N>&) = delete;
+	virtual ~BinaryTrie();
+
+	int size();
+	bool add(T x);
+	T remove(T x);
+	T find(const T& x);	// Smallest value >= x
+	N* findLeaf(T x);	// Leaf holding the smallest value >= x, or nullptr
+
+	long bytesUsed();	// See ds/memory.h
+	virtual long bytesReserved();
+};
+
+
+/**
+* BinaryTrie that finds the deepest node on a path with a binary search
+* over the depths, keeping the nodes at each depth in a hash table.
+*/
+template <class T, class N = BinaryTrieNode<T> >
+class XFastTrie: public BinaryTrie<T, N> {
+	typedef BinaryTrieNode<T> Node;
+
+	Array<SwissHashMap<T, Node*> > t;	// t[i] maps the i-bit prefixes to the nodes at depth i
+
+	Node* deepestPrefix(T x, int &i);
+
+public:
+	XFastTrie(): t(8 * sizeof(T) + 1) {}
+
+	bool add(T x);
+	T remove(T x);
+	long bytesReserved();
+};
+
+
+template <class T>
+class YFastTrieNode: public BinaryTrieNode<T> {
+public:
+	Treap<T>* bucket = nullptr;	// In leaves, holds the values in (previous key, key]
+};
+
+
+/**
+* Values are split into buckets of about w consecutive values, each a
+* Treap. The largest value in each bucket is stored in an XFastTrie.
+*/
+template <class T>
+class YFastTrie: public ISortedSet<T> {
+	static_assert(std::is_unsigned<T>::value, "YFastTrie keys must be unsigned integers");
+
+	static const int w = 8 * sizeof(T);
+
+	XFastTrie<T, YFastTrieNode<T> > keys;
+	int n;
+
+public:
+	YFastTrie();
+	YFastTrie(const YFastTrie<T>&) = delete;
+	YFastTrie<T>& operator=(const YFastTrie<T>&) = delete;
+	~YFastTrie();
+
+	int size();
+	bool add(T x);
+	T remove(T x);
+	T find(const T& x);	// Smallest value >= x
+
+	long bytesUsed();
+	long bytesReserved();
+};
+
+#include "../../src/tries/BinaryTrie.cpp"
+#include "../../src/tries/XFastTrie.cpp"
+#include "../../src/tries/YFastTrie.cpp"
+
+#endif
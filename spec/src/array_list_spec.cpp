@@ -1,12 +1,20 @@
+#include <atomic>
+#include <functional>
 #include <iostream>
+#include <stdexcept>
 
 #include "ds/array_lists.h"
 
 using namespace std;
 
+#include "./helpers/counted.cpp"
+#include "./helpers/lists/capacity_check.cpp"
 #include "./helpers/lists/deque_check.cpp"
 #include "./helpers/lists/list_check.cpp"
+#include "./helpers/lists/move_check.cpp"
+#include "./helpers/lists/parallel_check.cpp"
 #include "./helpers/lists/queue_check.cpp"
+#include "./helpers/lists/scan_check.cpp"
 #include "./helpers/lists/stack_check.cpp"
 
 int main() {
@@ -14,15 +22,66 @@ int main() {
 	ArrayStack<int> as;
 	listCheck(as);
 	stackCheck(as);
+	capacityCheck(as);
+	scanCheck(as);
+	ArrayStack<long> asl;
+	parallelCheck(asl);
+	ArrayStack<Counted> asc;
+	moveCheck(asc);
+
+	cout << endl << "Testing ArrayStack with 4 inline slots" << endl;
+	ArrayStack<int, 4> sas;
+	listCheck(sas);
+	stackCheck(sas);
+	capacityCheck(sas);
+	ArrayStack<Counted, 4> sasc;
+	moveCheck(sasc);
+	{
+		ArrayStack<int, 4> small, big;
+		small.push(1);
+		for (int i = 0; i < 10; i++){
+			big.push(i);
+		}
+		ArrayStack<int, 4> movedSmall(std::move(small));
+		ArrayStack<int, 4> movedBig(std::move(big));
+		cout << " moved stacks hold " << movedSmall.get(0) << " and " << movedBig.get(9)
+			<< ", moved-from sizes are " << small.size() << " and " << big.size() << endl;
+		ArrayStack<int> heap;
+		heap.push(1);
+		ArrayStack<int> movedHeap(std::move(heap));
+		cout << " a moved-from ArrayStack<int> sums to " << heap.sum() << ", and after push(5) to ";
+		heap.push(5);
+		cout << heap.sum() << endl;
+	}
 
 	cout << endl << "Testing FastArrayStack" << endl;
 	FastArrayStack<int> fas;
 	listCheck(fas);
 	stackCheck(fas);
+	capacityCheck(fas);
+	scanCheck(fas);
+	FastArrayStack<long> fasl;
+	parallelCheck(fasl);
+	FastArrayStack<Counted> fasc;
+	moveCheck(fasc);
 
 	cout << endl << "Testing ArrayQueue" << endl;
 	ArrayQueue<int> aq;
 	queueCheck(aq);
+	try {
+		aq.dequeue();
+		cout << " dequeue() on an empty queue did not throw" << endl;
+	} catch(out_of_range &e){
+		cout << " dequeue() on an empty queue throws: " << e.what() << endl;
+	}
+
+	cout << endl << "Testing ArrayQueue with 4 inline slots" << endl;
+	ArrayQueue<int, 4> saq;
+	queueCheck(saq);
+	saq.reserve(100);
+	cout << " after reserve(100), capacity is " << saq.capacity() << endl;
+	saq.shrinkToFit();
+	cout << " after shrinkToFit() while empty, capacity is " << saq.capacity() << endl;
 
 	cout << endl << "Testing ArrayDeque" << endl;
 	ArrayDeque<int> ad;
@@ -30,10 +89,28 @@ int main() {
 	queueCheck(ad);
 	stackCheck(ad);
 	dequeCheck(ad);
+	capacityCheck(ad);
+	scanCheck(ad);
+	ArrayDeque<long> adl;
+	parallelCheck(adl);
+	ArrayDeque<Counted> adc;
+	moveCheck(adc);
 
 	cout << endl << "Testing DualArrayDeque" << endl;
 	DualArrayDeque<int> dad;
 	listCheck(dad);
+	capacityCheck(dad);
+	DualArrayDeque<int> dadShrink;
+	for (int i = 0; i < 1000; i++){
+		dadShrink.add(dadShrink.size(), i);
+	}
+	while (dadShrink.size() > 10){
+		dadShrink.remove(0);	// Empties front, so every few removes rebalance
+	}
+	cout << " without reserve(), growing to 1000 and removing from the front down to 10 leaves capacity "
+		<< dadShrink.capacity() << endl;
+	DualArrayDeque<long> dadl;
+	parallelCheck(dadl);
 
 	return 0;
 }
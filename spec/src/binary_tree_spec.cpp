@@ -7,6 +7,15 @@
 
 using namespace std;
 
+#include "./helpers/lists/list_check.cpp"
+
+void printList(ImplicitTreap<int> &t){
+	for (int i = 0; i < t.size(); i++){
+		cout << " " << t.get(i);
+	}
+	cout << endl;
+}
+
 int main(){
 	cout << endl << "Testing BinarySearchTree" << endl;
 	BinarySearchTree<int> bst;
@@ -37,6 +46,23 @@ int main(){
 	cout << "Fifth largest number is: " << bst.nthLargest(5) << endl;
 	cout << "Sixth largest number is: " << bst.nthLargest(6) << endl;
 
+	cout << "In order:";
+	for (BinarySearchTree<int>::iterator it = bst.begin(); it != bst.end(); ++it){
+		cout << " " << *it;
+	}
+	cout << endl;
+	cout << "In reverse order:";
+	for (BinarySearchTree<int>::iterator it = bst.end(); it != bst.begin(); ){
+		cout << " " << *--it;
+	}
+	cout << endl;
+	cout << "Keys in [4, 10):";
+	for (int x : bst.range(4, 10)){
+		cout << " " << x;
+	}
+	cout << endl;
+	cout << "First key > 9: " << *bst.upper_bound(9) << endl;
+
 	cout << "removing " << bst.remove(10) << ", tree size is now " << bst.size() << endl;
 	cout << "removing root node " << bst.remove(8) << ", tree size is now " << bst.size() << endl;
 
@@ -73,6 +99,130 @@ int main(){
 	treap.draw();
 
 	cout << "Next largest number to 5: " << treap.find(5) << endl;
+	cout << "Keys in [5, 100):";
+	for (int x : treap.range(5, 100)){
+		cout << " " << x;
+	}
+	cout << endl;
+
+
+	cout << "Testing Treap set algebra" << endl;
+	Treap<int> evens, odds, small;
+	for (int i = 0; i < 20; i++){
+		if (i % 2 == 0){
+			evens.add(i);
+		} else {
+			odds.add(i);
+		}
+	}
+	for (int i = 0; i < 6; i++){
+		small.add(i);
+	}
+	evens.unionWith(odds);
+	cout << " union of evens and odds has size " << evens.size() << ", odds now has size " << odds.size() << endl;
+	Treap<int> threes;
+	for (int i = 0; i < 20; i += 3){
+		threes.add(i);
+	}
+	evens.differenceWith(threes);
+	cout << " without multiples of 3:";
+	for (int x : evens){
+		cout << " " << x;
+	}
+	cout << endl;
+	evens.intersectWith(small);
+	cout << " intersected with 0-5:";
+	for (int x : evens){
+		cout << " " << x;
+	}
+	cout << endl;
+	Treap<int> upper;
+	for (int i = 0; i < 10; i++){
+		upper.add(i);
+	}
+	Treap<int> lower;
+	upper.splitAt(4, lower);
+	cout << " splitting 0-9 at 4 leaves sizes " << lower.size() << " and " << upper.size() << endl;
+
+
+	cout << endl << "Testing PersistentTreap" << endl;
+	PersistentTreap<int> ptreap;
+	ptreap.add(8);
+	ptreap.add(3);
+	ptreap.add(4);
+	PersistentTreap<int> before = ptreap.snapshot();
+	ptreap.add(10);
+	ptreap.remove(3);
+	cout << " size is " << ptreap.size() << ", snapshot size is " << before.size() << endl;
+	cout << "Next largest number to 2: " << ptreap.find(2) << ", in snapshot: " << before.find(2) << endl;
+	try {
+		cout << "Next largest number to 9 in snapshot: " << before.find(9) << endl;
+	} catch(std::out_of_range&){
+		cout << "There are no numbers larger than 9 in the snapshot" << endl;
+	}
+
+
+	cout << endl << "Testing RedBlackTree" << endl;
+	RedBlackTree<int> rbt;
+	// Sorted input would turn the BinarySearchTree into a linked list
+	for (int i = 0; i < 20; i++){
+		rbt.add(i);
+	}
+	rbt.draw();
+	cout << " size is " << rbt.size() << ", black height is " << rbt.verify() << endl;
+	for (int i = 0; i < 20; i += 3){
+		rbt.remove(i);
+	}
+	cout << " size after removing every third number is " << rbt.size() << ", black height is " << rbt.verify() << endl;
+	cout << "Next largest number to 9: " << rbt.find(9) << endl;
+	try {
+		rbt.remove(3);
+	} catch(std::out_of_range&){
+		cout << "3 has already been removed" << endl;
+	}
+
+
+	cout << endl << "Testing ScapegoatTree" << endl;
+	ScapegoatTree<int> sgt;
+	for (int i = 0; i < 20; i++){
+		sgt.add(i);
+	}
+	sgt.draw();
+	cout << " size is " << sgt.size() << endl;
+	for (int i = 0; i < 15; i++){
+		sgt.remove(i);
+	}
+	cout << " size after removing 0 to 14 is " << sgt.size() << endl;
+	sgt.draw();
+	cout << "Next largest number to 3: " << sgt.find(3) << endl;
+
+
+	cout << endl << "Testing ImplicitTreap" << endl;
+	ImplicitTreap<int> it;
+	listCheck(it);
+	for (int i = 0; i < 10; i++){
+		it.add(i, i);
+	}
+	it.add(5, 100);
+	cout << " 0 to 9, then add(5, 100):";
+	printList(it);
+	it.reverse(2, 8);
+	cout << " reverse(2, 8):";
+	printList(it);
+	ImplicitTreap<int> front;
+	it.splitAt(4, front);
+	cout << " splitAt(4) leaves";
+	printList(it);
+	cout << " and moves";
+	printList(front);
+	front.concat(it);
+	cout << " concatenated back, size " << front.size() << " and other size " << it.size() << ":";
+	printList(front);
+	try {
+		front.get(11);
+	} catch(std::out_of_range&){
+		cout << " get(11) on a list of 11 throws" << endl;
+	}
 
 	return 0;
 }
@@ -0,0 +1,94 @@
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ds/concurrency.h"
+
+using namespace std;
+
+#include "./helpers/lists/queue_check.cpp"
+
+int main(){
+	cout << endl << "Testing BlockingQueue" << endl;
+	BlockingQueue<int> q(3);
+	queueCheck(q);
+
+	cout << " tryEnqueue(1..3) returns " << q.tryEnqueue(1) << q.tryEnqueue(2) << q.tryEnqueue(3)
+		<< ", tryEnqueue(4) on a full queue returns " << q.tryEnqueue(4) << endl;
+	cout << " tryEnqueueFor(4, 10ms) on a full queue returns "
+		<< q.tryEnqueueFor(4, chrono::milliseconds(10)) << endl;
+	int buf[4];
+	int m = q.tryDequeueBulk(buf, 4);
+	cout << " tryDequeueBulk(4) took " << m << ":";
+	for (int i = 0; i < m; i++){
+		cout << " " << buf[i];
+	}
+	cout << endl;
+	int x = -1;
+	cout << " tryDequeue on an empty queue returns " << q.tryDequeue(x)
+		<< ", tryDequeueFor(10ms) returns " << q.tryDequeueFor(x, chrono::milliseconds(10)) << endl;
+
+	cout << "Testing with 2 producers and 2 consumers:" << endl;
+	BlockingQueue<int> shared(16);
+	vector<long> sums(2, 0);
+	vector<thread> threads;
+	for (int t = 0; t < 2; t++){
+		// Each consumer takes batches of up to 8 until the queue is closed and drained
+		threads.push_back(thread([&shared, &sums, t](){
+			int batch[8];
+			int got;
+			while ((got = shared.dequeueBulk(batch, 8)) > 0){
+				for (int i = 0; i < got; i++){
+					sums[t] += batch[i];
+				}
+			}
+		}));
+	}
+	vector<thread> producers;
+	for (int t = 0; t < 2; t++){
+		// Between them the producers enqueue 1..10000
+		producers.push_back(thread([&shared, t](){
+			for (int i = 1 + t; i <= 10000; i += 2){
+				shared.enqueue(i);
+			}
+		}));
+	}
+	for (size_t t = 0; t < producers.size(); t++){
+		producers[t].join();
+	}
+	shared.close();
+	for (size_t t = 0; t < threads.size(); t++){
+		threads[t].join();
+	}
+	cout << " consumers received a total of " << sums[0] + sums[1] << " (expected 50005000)" << endl;
+
+	cout << " after close(), tryEnqueue(1) returns " << shared.tryEnqueue(1) << endl;
+	try {
+		shared.enqueue(1);
+		cout << " enqueue() after close() did not throw" << endl;
+	} catch(logic_error &e){
+		cout << " enqueue() after close() throws: " << e.what() << endl;
+	}
+	try {
+		shared.dequeue();
+		cout << " dequeue() on a closed, empty queue did not throw" << endl;
+	} catch(out_of_range &e){
+		cout << " dequeue() on a closed, empty queue throws: " << e.what() << endl;
+	}
+
+	cout << endl << "Testing forkJoin" << endl;
+	try {
+		forkEach(4, [](int t){
+			if (t == 2){
+				throw runtime_error("task 2 failed");
+			}
+		});
+		cout << " a throwing task was not reported" << endl;
+	} catch(runtime_error &e){
+		cout << " forkEach with a throwing task throws: " << e.what() << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,43 @@
+#include <iostream>
+#include <stdexcept>
+
+#include "ds/caches.h"
+
+using namespace std;
+
+#include "./helpers/caches/cache_check.cpp"
+
+int main(){
+	cout << endl << "Testing LRUCache" << endl;
+	LRUCache<int, int> lru(4);
+	cacheCheck(lru);
+
+	cout << endl << "Testing LFUCache" << endl;
+	LFUCache<int, int> lfu(4);
+	cacheCheck(lfu);
+
+	// The LRU evicts the oldest entry even if it was used often
+	for (int k = 1; k <= 4; k++){
+		lru.put(k, k);
+		lfu.put(k, k);
+	}
+	for (int i = 0; i < 3; i++){
+		lru.get(1);
+		lfu.get(1);
+	}
+	for (int k = 2; k <= 4; k++){
+		lru.get(k);
+		lfu.get(k);
+	}
+	lru.put(5, 5);
+	lru.put(6, 6);
+	lfu.put(5, 5);
+	lfu.put(6, 6);
+	cout << endl << "Getting 1 three times and 2 3 4 once, then putting 5 and 6" << endl;
+	cout << " LRUCache";
+	printKeys(lru, 9);
+	cout << " LFUCache";
+	printKeys(lfu, 9);
+
+	return 0;
+}
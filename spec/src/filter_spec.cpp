@@ -0,0 +1,77 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "ds/binary_trees.h"
+#include "ds/filters.h"
+
+using namespace std;
+
+int main(){
+	cout << endl << "Testing BloomFilter" << endl;
+	BloomFilter<int> bf(1000, 0.01);
+	for (int i = 0; i < 1000; i++){
+		bf.add(3*i);
+	}
+	int missing = 0;
+	for (int i = 0; i < 1000; i++){
+		missing += !bf.mightContain(3*i);
+	}
+	cout << " after adding 1000 values, " << missing << " of them are reported absent" << endl;
+	int falsePositives = 0;
+	for (int i = 0; i < 10000; i++){
+		falsePositives += bf.mightContain(3*i + 1);
+	}
+	cout << " " << falsePositives << " of 10000 absent values pass the filter (target 1%, estimate "
+		<< 100 * bf.falsePositiveRate() << "%)" << endl;
+	cout << " uses " << bf.bytesReserved() << " bytes" << endl;
+	bf.clear();
+	cout << " after clear(), size is " << bf.size() << " and mightContain(0) is " << bf.mightContain(0) << endl;
+
+	BloomFilter<string> words(10, 0.01);
+	words.add("apple");
+	words.add("pear");
+	cout << " strings: mightContain(apple) is " << words.mightContain("apple")
+		<< ", mightContain(plum) is " << words.mightContain("plum") << endl;
+	double badRates[] = {0, 1};
+	for (double rate : badRates){
+		try {
+			BloomFilter<int> bad(10, rate);
+			cout << " a false positive rate of " << rate << " did not throw" << endl;
+		} catch(invalid_argument &e){
+			cout << " a false positive rate of " << rate << " throws: " << e.what() << endl;
+		}
+	}
+
+	cout << endl << "Testing FilteredSortedSet" << endl;
+	Treap<int> t;
+	FilteredSortedSet<int> s(t, 100);
+	for (int i = 0; i < 100; i++){
+		s.add(2*i);
+	}
+	cout << " add(10) again returns " << s.add(10) << ", size is " << s.size() << endl;
+	cout << " contains(10) is " << s.contains(10) << ", contains(11) is " << s.contains(11)
+		<< ", contains(1000) is " << s.contains(1000) << endl;
+	cout << " find(11) is " << s.find(11) << endl;
+	s.remove(10);
+	cout << " after remove(10), contains(10) is " << s.contains(10) << endl;
+
+	s.resetStats();
+	int found = 0;
+	for (int i = 0; i < 1000; i++){
+		found += s.contains(i);
+	}
+	FilterStats st = s.stats();
+	cout << " contains(0..999) found " << found << ": " << st.lookups << " lookups, "
+		<< st.filtered << " filtered, " << st.hits << " hits, " << st.falsePositives
+		<< " false positives, saved rate " << st.savedRate() << endl;
+
+	try {
+		FilteredSortedSet<int> again(t, 100);
+		cout << " wrapping a non-empty set did not throw" << endl;
+	} catch(invalid_argument &e){
+		cout << " wrapping a non-empty set throws: " << e.what() << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,53 @@
+#include <iostream>
+#include <stdexcept>
+
+#include "ds/flat_sets.h"
+
+using namespace std;
+
+#include "./helpers/sets/sortedset_check.cpp"
+
+int main(){
+	cout << endl << "Testing FlatSortedSet" << endl;
+	FlatSortedSet<unsigned> fs;
+	sortedSetCheck(fs);
+
+	cout << endl << "Testing FlatSortedSet bulk loading" << endl;
+	FlatSortedSet<unsigned> bulk;
+	bulk.add(7);
+	bulk.add(3);
+	unsigned xs[] = {42, 7, 15, 4, 42, 23, 8, 16, 3, 4};
+	cout << " addAll of 10 values with 4 repeats returns " << bulk.addAll(xs, 10) << endl;
+	cout << " size is " << bulk.size() << endl;
+	cout << " in order:";
+	for (unsigned x = 0; x <= 42; x = bulk.find(x) + 1){
+		cout << " " << bulk.find(x);
+	}
+	cout << endl;
+
+	// Interleave adds and removes across several merges of the pending values
+	FlatSortedSet<unsigned> mixed;
+	unsigned* ys = new unsigned[5000];
+	for (int i = 0; i < 5000; i++){
+		ys[i] = (unsigned)i * 7919 % 10007;	// Distinct, since 10007 is prime
+	}
+	mixed.addAll(ys, 2500);
+	for (int i = 2500; i < 5000; i++){
+		mixed.add(ys[i]);
+		if (i % 3 == 0){
+			mixed.remove(ys[i - 2500]);
+		}
+	}
+	int seen = 0;
+	try {
+		for (unsigned x = mixed.find(0); ; x = mixed.find(x + 1)){
+			seen++;
+		}
+	} catch(std::out_of_range&){}
+	cout << " after mixed updates, size is " << mixed.size() << " and walking with find() visits " << seen << " values" << endl;
+	mixed.compact();
+	cout << " contains(" << ys[4999] << ") after compact(): " << mixed.contains(ys[4999]) << endl;
+	delete[] ys;
+
+	return 0;
+}
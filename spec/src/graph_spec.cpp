@@ -0,0 +1,106 @@
+#include <iostream>
+#include <stdexcept>
+#include <stdlib.h>
+#include <string>
+
+#include "ds/array_lists.h"
+#include "ds/graphs.h"
+
+using namespace std;
+
+#include "./helpers/graphs/graph_check.cpp"
+
+void printDistances(string label, int* dist, int n){
+	cout << " " << label << ":";
+	for (int i = 0; i < n; i++){
+		cout << " " << dist[i];
+	}
+	cout << endl;
+}
+
+int main(){
+	cout << endl << "Testing AdjacencyMatrix" << endl;
+	AdjacencyMatrix am(5);
+	graphCheck(am);
+
+	cout << endl << "Testing AdjacencyLists" << endl;
+	AdjacencyLists al(5);
+	graphCheck(al);
+
+	cout << endl << "Testing CSRGraph" << endl;
+	//   0 -> 1 (4), 0 -> 2 (1), 2 -> 1 (2), 1 -> 3 (5), 2 -> 3 (8), 3 -> 4 (3)
+	int sources[] = {0, 0, 2, 1, 2, 3};
+	int targets[] = {1, 2, 1, 3, 3, 4};
+	int weights[] = {4, 1, 2, 5, 8, 3};
+	CSRGraph csr(6, 6, sources, targets, weights);
+	cout << " graph has " << csr.nVertices() << " vertices and " << csr.nEdges() << " edges" << endl;
+	cout << " hasEdge(2, 1) returns " << csr.hasEdge(2, 1) << endl;
+	cout << " hasEdge(1, 2) returns " << csr.hasEdge(1, 2) << endl;
+	cout << " out edges of 2:";
+	csr.forEachOutEdge(2, [](int j, int w){ cout << " " << j << " (weight " << w << ")"; });
+	cout << endl;
+	cout << " in edges of 3:";
+	csr.forEachInEdge(3, [](int j, int w){ cout << " " << j << " (weight " << w << ")"; });
+	cout << endl;
+
+	cout << endl << "Testing traversals from 0" << endl;
+	int dist[6];
+	bfs(csr, 0, dist);
+	printDistances("bfs distances", dist, 6);
+	parallelBFS(csr, 0, dist);
+	printDistances("parallelBFS distances", dist, 6);
+	int order[6];
+	int visited = dfs(csr, 0, order);
+	printDistances("dfs order", order, visited);
+	long weighted[6];
+	dijkstra(csr, 0, weighted);
+	cout << " dijkstra distances:";
+	for (int i = 0; i < 6; i++){
+		cout << " " << weighted[i];
+	}
+	cout << endl;
+
+	CSRGraph fromLists(al);
+	bfs(fromLists, 3, dist);
+	printDistances("bfs distances from 3 in the AdjacencyLists graph", dist, 5);
+	try {
+		bfs(csr, 6, dist);
+	} catch(std::out_of_range&){
+		cout << " bfs from vertex 6 of 6 throws out_of_range" << endl;
+	}
+	try {
+		parallelBFS(csr, -1, dist);
+	} catch(std::out_of_range&){
+		cout << " parallelBFS from vertex -1 throws out_of_range" << endl;
+	}
+
+	// A random graph has a small diameter, so parallelBFS switches to
+	// bottom-up steps for the middle levels and back again
+	cout << endl << "Testing parallelBFS on a random graph" << endl;
+	int n = 20000;
+	int m = 8 * n;
+	Array<int> randomSources(m);
+	Array<int> randomTargets(m);
+	srand(1);
+	for (int k = 0; k < m; k++){
+		randomSources[k] = rand() % n;
+		randomTargets[k] = rand() % n;
+	}
+	CSRGraph random(n, m, &randomSources[0], &randomTargets[0]);
+	Array<int> expected(n);
+	Array<int> found(n);
+	bfs(random, 0, &expected[0]);
+	parallelBFS(random, 0, &found[0]);
+	bool same = true;
+	int reached = 0;
+	int deepest = 0;
+	for (int i = 0; i < n; i++){
+		same = same && found[i] == expected[i];
+		reached += expected[i] != -1;
+		deepest = std::max(deepest, expected[i]);
+	}
+	cout << " bfs reaches " << reached << " of " << n << " vertices in " << deepest << " levels" << endl;
+	cout << " parallelBFS distances match bfs: " << (same ? "yes" : "no") << endl;
+
+	return 0;
+}
@@ -0,0 +1,47 @@
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "ds/hash_tables.h"
+
+using namespace std;
+
+#include "./helpers/counted.cpp"
+#include "./helpers/sets/uset_check.cpp"
+#include "./helpers/sets/uset_move_check.cpp"
+
+int main(){
+	cout << endl << "Testing ChainedHashTable" << endl;
+	ChainedHashTable<int> cht;
+	usetCheck(cht);
+	ChainedHashTable<Counted> chtc;
+	usetMoveCheck(chtc);
+
+	cout << endl << "Testing LinearHashTable" << endl;
+	LinearHashTable<int> lht;
+	usetCheck(lht);
+	LinearHashTable<Counted> lhtc;
+	usetMoveCheck(lhtc);
+
+	cout << endl << "Testing SwissHashSet" << endl;
+	SwissHashSet<int> shs;
+	usetCheck(shs);
+	SwissHashSet<Counted> shsc;
+	usetMoveCheck(shsc);
+	cout << " contains(999) returns " << shs.contains(999) << endl;
+
+	cout << endl << "Testing SwissHashMap" << endl;
+	SwissHashMap<string, int> shm;
+	shm.put("one", 1);
+	shm.put("two", 2);
+	shm.put("three", 3);
+	cout << " putting \"two\" again returns " << shm.put("two", 22) << endl;
+	cout << " get(\"two\") returns " << shm.get("two") << endl;
+	cout << " removing \"one\" returns " << shm.remove("one") << ", size is now " << shm.size() << endl;
+	if (shm.lookup("one") == nullptr){
+		cout << " \"one\" is no longer in the map" << endl;
+	}
+
+	return 0;
+}
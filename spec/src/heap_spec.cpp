@@ -0,0 +1,52 @@
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "ds/heaps.h"
+
+using namespace std;
+
+#include "./helpers/counted.cpp"
+#include "./helpers/heaps/priority_queue_check.cpp"
+#include "./helpers/heaps/priority_queue_move_check.cpp"
+
+int main(){
+	cout << endl << "Testing BinaryHeap (binary)" << endl;
+	BinaryHeap<int, 2> bh2;
+	priorityQueueCheck(bh2);
+
+	cout << endl << "Testing BinaryHeap (4-ary)" << endl;
+	BinaryHeap<int> bh4;
+	priorityQueueCheck(bh4);
+	bh4.add(10);
+	int more[] = {4, 12, 0, 6, 2, 8};
+	bh4.addAll(more, 6);
+	cout << " after add(10) and addAll(4 12 0 6 2 8), removing all:";
+	while (bh4.size() > 0){
+		cout << " " << bh4.remove();
+	}
+	cout << endl;
+	BinaryHeap<Counted> bhc;
+	priorityQueueMoveCheck(bhc);
+
+	cout << endl << "Testing MeldableHeap" << endl;
+	MeldableHeap<int> mh;
+	priorityQueueCheck(mh);
+	MeldableHeap<int> other;
+	for (int i = 0; i < 5; i++){
+		mh.add(2*i);
+		other.add(2*i + 1);
+	}
+	mh.meld(other);
+	cout << " melding 0 2 4 6 8 with 1 3 5 7 9, size is " << mh.size() << " and other size is " << other.size() << endl;
+	cout << " removing all:";
+	while (mh.size() > 0){
+		cout << " " << mh.remove();
+	}
+	cout << endl;
+	MeldableHeap<Counted> mhc;
+	priorityQueueMoveCheck(mhc);
+
+	return 0;
+}
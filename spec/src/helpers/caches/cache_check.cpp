@@ -0,0 +1,62 @@
+void printKeys(Cache<int, int> &c, int maxKey){
+	cout << " cached keys:";
+	for (int k = 0; k <= maxKey; k++){
+		if (c.contains(k)){
+			cout << " " << k;
+		}
+	}
+	cout << endl;
+}
+
+void cacheCheck(Cache<int, int> &c){
+	cout << "Testing cache interface (capacity " << c.capacity() << "):" << endl;
+
+	for (int k = 1; k <= 3; k++){
+		c.put(k, 10*k);
+	}
+	cout << " put 1 2 3, size is " << c.size() << endl;
+	cout << " get(1) returns " << c.get(1) << ", get(1) again returns " << c.get(1) << endl;
+	cout << " lookup(2) returns " << *c.lookup(2) << endl;
+	cout << " lookup(9) is nullptr: " << (c.lookup(9) == nullptr) << endl;
+	try {
+		c.get(9);
+	} catch(std::out_of_range&){
+		cout << " get(9) throws" << endl;
+	}
+
+	c.put(4, 40);
+	cout << " after put(4, 40)";
+	printKeys(c, 9);
+	c.put(5, 50);
+	cout << " after put(5, 50)";
+	printKeys(c, 9);
+
+	cout << " put(2, 21) returns " << c.put(2, 21) << ", get(2) returns " << c.get(2) << endl;
+	cout << " remove(2) returns " << c.remove(2) << ", size is " << c.size() << endl;
+	try {
+		c.remove(2);
+	} catch(std::out_of_range&){
+		cout << " remove(2) again throws" << endl;
+	}
+
+	CacheStats s = c.stats();
+	cout << " " << s.hits << " hits, " << s.misses << " misses, " << s.evictions
+		<< " evictions, hit rate " << s.hitRate() << endl;
+
+	cout << " put(7, 70, weight " << c.capacity() + 1 << ") returns " << c.put(7, 70, c.capacity() + 1)
+		<< ", rejections is " << c.stats().rejections << endl;
+	c.clear();
+	c.resetStats();
+	cout << " after clear(), size is " << c.size() << " and weight is " << c.weight() << endl;
+
+	// Weighted entries: capacity counts bytes rather than entries
+	c.put(1, 10, 2);
+	c.put(2, 20, 1);
+	c.put(3, 30, 1);
+	cout << " put 1 2 3 with weights 2 1 1, weight is " << c.weight() << endl;
+	c.get(1);
+	c.put(4, 40, 2);
+	cout << " after get(1) and put(4, 40, 2), weight is " << c.weight() << " and";
+	printKeys(c, 9);
+	c.clear();
+}
@@ -0,0 +1,27 @@
+/**
+* Counts how often it is copied, so a check can tell
+* whether a container moved its elements or copied them.
+*/
+struct Counted {
+	static int copies;
+	int x;
+
+	Counted(int _x = 0) : x(_x) {}
+	Counted(const Counted& c) : x(c.x) { copies++; }
+	Counted(Counted&& c) : x(c.x) {}
+	Counted& operator=(const Counted& c) { x = c.x; copies++; return *this; }
+	Counted& operator=(Counted&& c) { x = c.x; return *this; }
+
+	bool operator<(const Counted& c) const { return x < c.x; }
+	bool operator==(const Counted& c) const { return x == c.x; }
+};
+
+int Counted::copies = 0;
+
+namespace std {
+	template <>
+	struct hash<Counted> {
+		size_t operator()(const Counted& c) const { return hash<int>()(c.x); }
+	};
+}
+
@@ -0,0 +1,30 @@
+void printList(string label, ArrayStack<int> &list){
+	cout << " " << label << ":";
+	for (int i = 0; i < list.size(); i++){
+		cout << " " << list.get(i);
+	}
+	cout << endl;
+}
+
+void graphCheck(IGraph &g){
+	cout << "Testing graph interface:" << endl;
+	cout << " graph has " << g.nVertices() << " vertices" << endl;
+
+	g.addEdge(0, 1);
+	g.addEdge(0, 2);
+	g.addEdge(1, 2);
+	g.addEdge(2, 0);
+	g.addEdge(3, 2);
+	cout << " hasEdge(0, 2) returns " << g.hasEdge(0, 2) << endl;
+	cout << " hasEdge(2, 1) returns " << g.hasEdge(2, 1) << endl;
+
+	ArrayStack<int> out;
+	g.outEdges(0, out);
+	printList("out edges of 0", out);
+	ArrayStack<int> in;
+	g.inEdges(2, in);
+	printList("in edges of 2", in);
+
+	g.removeEdge(0, 2);
+	cout << " after removeEdge(0, 2), hasEdge(0, 2) returns " << g.hasEdge(0, 2) << endl;
+}
@@ -0,0 +1,41 @@
+void priorityQueueCheck(IPriorityQueue<int> &pq){
+	cout << "Testing priority queue interface:" << endl;
+
+	try {
+		pq.peek();
+	} catch(std::out_of_range&){
+		cout << " peek() on an empty queue throws" << endl;
+	}
+
+	int xs[] = {5, 3, 9, 1, 7, 3, 8};
+	for (int i = 0; i < 7; i++){
+		pq.add(xs[i]);
+	}
+	cout << " added 5 3 9 1 7 3 8, size is " << pq.size() << endl;
+	cout << " peek() returns " << pq.peek() << endl;
+
+	cout << " removing all:";
+	while (pq.size() > 0){
+		cout << " " << pq.remove();
+	}
+	cout << endl;
+
+	try {
+		pq.remove();
+	} catch(std::out_of_range&){
+		cout << " remove() on an empty queue throws" << endl;
+	}
+
+	// Enough elements to force several resizes
+	for (int i = 999; i >= 0; i--){
+		pq.add(i);
+	}
+	bool sorted = true;
+	int last = -1;
+	while (pq.size() > 0){
+		int x = pq.remove();
+		sorted = sorted && x >= last;
+		last = x;
+	}
+	cout << " 1000 elements added in reverse come out sorted: " << sorted << endl;
+}
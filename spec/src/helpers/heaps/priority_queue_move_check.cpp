@@ -0,0 +1,18 @@
+template <class Heap>
+void priorityQueueMoveCheck(Heap &heap){
+	cout << "Testing moves:" << endl;
+
+	Counted::copies = 0;
+	for (int i = 0; i < 200; i++){
+		heap.add(Counted((i * 37) % 101));
+	}
+	bool ordered = true;
+	Counted last = heap.remove();
+	while (heap.size() > 50){
+		Counted x = heap.remove();
+		ordered = ordered && !(x < last);
+		last = std::move(x);
+	}
+	cout << " 200 adds and 150 removes come out in order: " << (ordered ? "yes" : "no") << endl;
+	cout << " elements copied: " << Counted::copies << endl;
+}
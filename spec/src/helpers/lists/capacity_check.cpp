@@ -0,0 +1,30 @@
+template <class List>
+void capacityCheck(List &list){
+	cout << "Testing capacity control:" << endl;
+
+	list.reserve(1000);
+	cout << " after reserve(1000), capacity is " << list.capacity() << endl;
+	for (int i = 0; i < 1000; i++){
+		list.add(list.size(), i);
+	}
+	cout << " after adding 1000 values, capacity is " << list.capacity() << endl;
+
+	while (list.size() > 10){
+		list.remove(list.size() - 1);
+	}
+	cout << " after removing down to 10 values, capacity is " << list.capacity() << endl;
+	list.shrinkToFit();
+	cout << " after shrinkToFit(), capacity is " << list.capacity() << endl;
+
+	list.setShrinkPolicy(ShrinkPolicy(8, 64));
+	list.reserve(200);
+	while (list.size() > 0){
+		list.remove(list.size() - 1);
+	}
+	cout << " with ShrinkPolicy(8, 64), emptying leaves capacity " << list.capacity() << endl;
+	for (int i = 0; i < 100; i++){
+		list.add(0, i);
+		list.remove(0);
+	}
+	cout << " after 100 adds and removes at size 0, capacity is " << list.capacity() << endl;
+}
@@ -0,0 +1,26 @@
+template <class List>
+void moveCheck(List &list){
+	cout << "Testing moves and emplace:" << endl;
+
+	Counted::copies = 0;
+	for (int i = 0; i < 100; i++){
+		list.emplace(list.size(), i);
+	}
+	for (int i = 0; i < 100; i++){
+		list.push(Counted(100 + i));
+	}
+	for (int i = 0; i < 50; i++){
+		list.emplace(0, -i);
+		list.remove(list.size() / 2);
+	}
+	int sum = 0;
+	for (int i = 0; i < list.size(); i++){
+		sum += list.get(i).x;
+	}
+	while (list.size() > 0){
+		Counted c = list.pop();
+		sum -= c.x;
+	}
+	cout << " values add up after 250 adds and 250 removes: " << (sum == 0 ? "yes" : "no") << endl;
+	cout << " elements copied: " << Counted::copies << endl;
+}
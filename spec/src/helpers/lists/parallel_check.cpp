@@ -0,0 +1,56 @@
+/**
+* Checks the parallel algorithms against loops over get(i) and set(i, x).
+* Values are added at both ends, so an ArrayDeque's elements wrap around
+* its backing array and a DualArrayDeque uses both halves.
+*/
+template <class List>
+void parallelCheck(List &list){
+	cout << "Testing parallel algorithms:" << endl;
+
+	int n = 100000;
+	for (int i = 0; i < n; i++){
+		if (i % 2 == 0){
+			list.add(0, i % 100);
+		} else {
+			list.add(list.size(), i % 100);
+		}
+	}
+	Array<long> expected(n);
+	for (int i = 0; i < n; i++){
+		expected[i] = list.get(i);
+	}
+
+	list.transform([](long x){ return 2*x + 1; });
+	bool same = true;
+	for (int i = 0; i < n; i++){
+		expected[i] = 2*expected[i] + 1;
+		same = same && list.get(i) == expected[i];
+	}
+	cout << " transform matches set(i, f(get(i))): " << (same ? "yes" : "no") << endl;
+
+	std::atomic<long> visited(0);
+	list.forEach([&](long &x){ visited++; x--; });
+	cout << " forEach visited " << visited << " of " << list.size() << endl;
+
+	long total = list.reduce(0L, [](long s, long x){ return s + x; });
+	long first = list.reduce(-1L, [](long a, long b){ return (a < 0) ? b : a; });	// Associative but not commutative
+	long sum = 0;
+	for (int i = 0; i < n; i++){
+		expected[i]--;
+		sum += expected[i];
+	}
+	cout << " reduce gives the sum " << total << (total == sum ? " as expected" : " but get(i) disagrees")
+		<< ", and the first element " << first << (first == expected[0] ? " as expected" : " but get(0) disagrees") << endl;
+
+	list.inclusiveScan([](long a, long b){ return a + b; });
+	same = list.get(0) == expected[0];
+	for (int i = 1; i < n; i++){
+		expected[i] += expected[i-1];
+		same = same && list.get(i) == expected[i];
+	}
+	cout << " inclusiveScan gives running totals: " << (same ? "yes" : "no") << ", last is " << list.get(n-1) << endl;
+
+	while (list.size() > 0){
+		list.remove(list.size() - 1);
+	}
+}
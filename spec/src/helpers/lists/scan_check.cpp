@@ -0,0 +1,54 @@
+/**
+* Checks the scans against a loop over get(i). Values are added at
+* both ends, so an ArrayDeque's elements wrap around its backing array.
+*/
+template <class List>
+void scanCheck(List &list){
+	cout << "Testing scans:" << endl;
+
+	try {
+		list.min();
+		cout << " min() on an empty list did not throw" << endl;
+	} catch(out_of_range &e){
+		cout << " min() on an empty list throws: " << e.what() << endl;
+	}
+
+	for (int i = 0; i < 1000; i++){
+		int x = (i * 7919) % 501 - 250;
+		if (i % 2 == 0){
+			list.add(0, x);
+		} else {
+			list.add(list.size(), x);
+		}
+	}
+	list.add(list.size(), 1000);
+
+	bool same = true;
+	for (int x = -260; x <= 260; x += 13){
+		int first = -1;
+		int c = 0;
+		for (int i = 0; i < list.size(); i++){
+			if (list.get(i) == x){
+				first = (first < 0) ? i : first;
+				c++;
+			}
+		}
+		same = same && list.indexOf(x) == first && list.count(x) == c && list.contains(x) == (c > 0);
+	}
+	long s = 0;
+	int lo = list.get(0);
+	int hi = list.get(0);
+	for (int i = 0; i < list.size(); i++){
+		s += list.get(i);
+		lo = std::min(lo, list.get(i));
+		hi = std::max(hi, list.get(i));
+	}
+	cout << " indexOf, count and contains agree with get(i): " << (same ? "yes" : "no") << endl;
+	cout << " indexOf(1000) is " << list.indexOf(1000) << " of " << list.size() << endl;
+	cout << " min " << list.min() << ", max " << list.max() << ", sum " << list.sum()
+		<< (lo == list.min() && hi == list.max() && s == list.sum() ? " as expected" : " but get(i) disagrees") << endl;
+
+	while (list.size() > 0){
+		list.remove(list.size() - 1);
+	}
+}
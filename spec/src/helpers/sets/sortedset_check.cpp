@@ -0,0 +1,37 @@
+void sortedSetCheck(ISortedSet<unsigned> &set){
+	cout << "Testing sorted set interface:" << endl;
+
+	unsigned xs[] = {40, 8, 4000000000u, 15, 16, 23, 42, 4};
+	for (int i = 0; i < 8; i++){
+		set.add(xs[i]);
+	}
+	cout << " adding 15 again returns " << set.add(15) << endl;
+	cout << " size is " << set.size() << endl;
+
+	cout << " find(16) returns " << set.find(16) << endl;
+	cout << " find(17) returns " << set.find(17) << endl;
+	cout << " find(0) returns " << set.find(0) << endl;
+	cout << " find(43) returns " << set.find(43) << endl;
+	try {
+		set.find(4000000001u);
+	} catch(std::out_of_range&){
+		cout << " there are no values >= 4000000001" << endl;
+	}
+
+	cout << " removed " << set.remove(16) << ", find(16) now returns " << set.find(16) << endl;
+	try {
+		set.remove(16);
+	} catch(std::out_of_range&){
+		cout << " 16 has already been removed" << endl;
+	}
+
+	// Enough values to split the YFastTrie into several buckets
+	for (unsigned i = 0; i < 1000; i++){
+		set.add(1000 + 3*i);
+	}
+	for (unsigned i = 0; i < 1000; i += 2){
+		set.remove(1000 + 3*i);
+	}
+	cout << " after adding 1000 values and removing half of them, size is " << set.size() << endl;
+	cout << " find(1001) returns " << set.find(1001) << endl;
+}
@@ -0,0 +1,36 @@
+void usetCheck(IUSet<int> &set){
+	cout << "Testing uset interface:" << endl;
+
+	for (int i = 0; i < 40; i += 4){
+		set.add(i);
+	}
+	cout << " adding 8 again returns " << set.add(8) << endl;
+	cout << " size is " << set.size() << endl;
+
+	cout << " find(12) returns " << set.find(12) << endl;
+	try {
+		set.find(13);
+	} catch(std::out_of_range&){
+		cout << " 13 is not in the set" << endl;
+	}
+
+	for (int i = 0; i < 40; i += 8){
+		cout << " removed " << set.remove(i) << endl;
+	}
+	cout << " size is " << set.size() << endl;
+
+	try {
+		set.remove(0);
+	} catch(std::out_of_range&){
+		cout << " 0 has already been removed" << endl;
+	}
+
+	// Enough elements to force several resizes
+	for (int i = 0; i < 1000; i++){
+		set.add(i);
+	}
+	for (int i = 0; i < 1000; i += 2){
+		set.remove(i);
+	}
+	cout << " after adding 0-999 and removing the even numbers, size is " << set.size() << endl;
+}
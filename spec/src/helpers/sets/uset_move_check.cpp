@@ -0,0 +1,19 @@
+template <class Set>
+void usetMoveCheck(Set &set){
+	cout << "Testing moves:" << endl;
+
+	Counted::copies = 0;
+	for (int i = 0; i < 200; i++){
+		set.add(Counted(7 * i));
+	}
+	for (int i = 0; i < 100; i++){
+		set.remove(Counted(14 * i));
+	}
+	cout << " elements copied by 200 adds and 100 removes: " << Counted::copies << endl;
+	Counted::copies = 0;
+	int found = 0;
+	for (int i = 0; i < 100; i++){
+		found += set.find(Counted(14 * i + 7)).x == 14 * i + 7;
+	}
+	cout << " " << found << " finds copy " << Counted::copies << " elements, the values returned" << endl;
+}
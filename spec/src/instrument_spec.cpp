@@ -0,0 +1,90 @@
+#include <iostream>
+
+#define DS_INSTRUMENT 1
+
+#include "ds/array_lists.h"
+#include "ds/binary_trees.h"
+#include "ds/instrument.h"
+#include "ds/linked_lists.h"
+
+using namespace std;
+
+void printStats(string name, OpStats s){
+	cout << " " << name << ": " << s.resizes << " resizes, " << s.copies << " copies, "
+		<< s.shifts << " shifts, " << s.balances << " balances, " << s.rotations
+		<< " rotations, " << s.steps << " steps" << endl;
+}
+
+int main(){
+	cout << endl << "Testing instrumentation" << endl;
+
+	ArrayStack<int> as;
+	for (int i = 0; i < 8; i++){
+		as.add(0, i);
+	}
+	printStats("ArrayStack, 8 adds at the front", as.stats());
+
+	FastArrayStack<int> fas;
+	for (int i = 0; i < 8; i++){
+		fas.add(i, i);
+	}
+	printStats("FastArrayStack, 8 adds at the back", fas.stats());
+
+	ArrayQueue<int> aq;
+	for (int i = 0; i < 8; i++){
+		aq.enqueue(i);
+	}
+	printStats("ArrayQueue, 8 enqueues", aq.stats());
+
+	ArrayStack<int> thrash;
+	for (int i = 0; i < 100; i++){
+		thrash.push(i);
+		thrash.pop();
+	}
+	printStats("ArrayStack, 100 pushes and pops at size 0", thrash.stats());
+
+	ArrayDeque<int> ad;
+	for (int i = 0; i < 8; i++){
+		ad.add(ad.size() / 2, i);
+	}
+	printStats("ArrayDeque, 8 adds in the middle", ad.stats());
+
+	DualArrayDeque<int> dad;
+	for (int i = 0; i < 8; i++){
+		dad.add(0, i);
+	}
+	printStats("DualArrayDeque, 8 adds at the front", dad.stats());
+
+	DLList<int> dll;
+	for (int i = 0; i < 8; i++){
+		dll.add(i / 2, i);
+	}
+	printStats("DLList, 8 adds in the middle", dll.stats());
+
+	Treap<int> t;
+	for (int i = 0; i < 8; i++){
+		t.add(i);
+	}
+	OpStats ts = t.stats();
+	cout << " Treap, 8 adds: rotations counted " << (ts.rotations > 0) << endl;
+
+	{
+		ArrayStack<int> temporary;
+		temporary.add(0, 1);
+	}
+	InstrumentRegistry &r = InstrumentRegistry::instance();
+	vector<InstrumentRegistry::Totals> totals = r.totals();
+	for (size_t i = 0; i < totals.size(); i++){
+		if (string(totals[i].name) == "ArrayStack"){
+			cout << " registry: ArrayStack instances " << totals[i].instances << ", live "
+				<< totals[i].live << ", resizes " << totals[i].stats.resizes << endl;
+		}
+	}
+	string json = r.toJSON();
+	cout << " JSON has a DualArrayDeque entry: " << (json.find("\"DualArrayDeque\": {") != string::npos) << endl;
+
+	r.reset();
+	printStats("ArrayStack after reset", as.stats());
+
+	return 0;
+}
@@ -1,11 +1,14 @@
+#include <functional>
 #include <iostream>
 
 #include "ds/linked_lists.h"
 
 using namespace std;
 
+#include "./helpers/counted.cpp"
 #include "./helpers/lists/deque_check.cpp"
 #include "./helpers/lists/list_check.cpp"
+#include "./helpers/lists/move_check.cpp"
 #include "./helpers/lists/queue_check.cpp"
 #include "./helpers/lists/stack_check.cpp"
 
@@ -21,6 +24,20 @@ int main(){
 	dequeCheck(dll);
 	stackCheck(dll);
 	queueCheck(dll);
+	DLList<Counted> dllc;
+	moveCheck(dllc);
+
+	DLList<int> handles;
+	DNode<int>* a = handles.addBefore(handles.end(), 1);
+	DNode<int>* b = handles.addBefore(handles.end(), 2);
+	handles.addBefore(handles.end(), 3);
+	handles.moveBefore(b, a);
+	handles.removeNode(a);
+	cout << " node handles: added 1 2 3, moved 2 before 1, removed 1:";
+	for (DNode<int>* u = handles.end()->next; u != handles.end(); u = u->next){
+		cout << " " << u->x;
+	}
+	cout << endl;
 
 	return 0;
 }
@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include "ds/mapped_arrays.h"
+#include "ds/snapshots.h"
+
+using namespace std;
+
+int main(){
+	const char* path = "/tmp/ods_mapped_spec.arr";
+	remove(path);
+
+	cout << endl << "Testing MappedArray" << endl;
+	{
+		MappedArray<int> a(path, 4);
+		for (int i = 0; i < 4; i++){
+			a[i] = 10*i;
+		}
+		a.resize(1000000);
+		cout << " after resize(1000000), length is " << a.length() << " and a[3] is " << a[3] << endl;
+		a.adviseRandom();
+		a.willNeed(0, 1000);
+		a.resize(2);
+		cout << " after resize(2), a[1] is " << a[1] << endl;
+		try {
+			a[2];
+			cout << " a[2] did not throw" << endl;
+		} catch(out_of_range &e){
+			cout << " a[2] throws: " << e.what() << endl;
+		}
+	}
+	remove(path);
+
+	cout << endl << "Testing MappedArrayStack" << endl;
+	{
+		MappedArrayStack<long> s(path);
+		for (long i = 0; i < 10; i++){
+			s.push(i*i);
+		}
+		s.add(0, -1);
+		s.remove(5);
+		cout << " size is " << s.size() << ", elements:";
+		for (long i = 0; i < s.size(); i++){
+			cout << " " << s.get(i);
+		}
+		cout << endl;
+		s.sync();
+	}
+	{
+		MappedArrayStack<long> s(path);
+		cout << " reopened, size is " << s.size() << ", pop() is " << s.pop() << endl;
+		ListView<long> v(path);
+		cout << " as a ListView, size is " << v.size() << " and get(1) is " << v.get(1) << endl;
+		cout << " bytesUsed is " << s.bytesUsed() << ", bytesReserved is " << s.bytesReserved() << endl;
+		try {
+			s.get(s.size());
+			cout << " get(size()) did not throw" << endl;
+		} catch(out_of_range &e){
+			cout << " get(size()) throws: " << e.what() << endl;
+		}
+	}
+	try {
+		MappedArrayStack<int> wrongType(path);
+		cout << " opening longs as ints did not throw" << endl;
+	} catch(runtime_error &e){
+		cout << " opening longs as ints throws: " << e.what() << endl;
+	}
+	truncate(path, sizeof(SnapshotHeader) + 3*sizeof(long) + 4);
+	try {
+		MappedArrayStack<long> partial(path);
+		cout << " opening a file ending part way through an element did not throw" << endl;
+	} catch(runtime_error &e){
+		cout << " opening a file ending part way through an element throws: " << e.what() << endl;
+	}
+
+	remove(path);
+	return 0;
+}
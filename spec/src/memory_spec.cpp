@@ -0,0 +1,142 @@
+#include <iostream>
+#include <string>
+
+#define DS_TRACK_ALLOCATIONS
+
+#include "ds/memory.h"
+#include "ds/array_lists.h"
+#include "ds/binary_trees.h"
+#include "ds/caches.h"
+#include "ds/concurrency.h"
+#include "ds/filters.h"
+#include "ds/graphs.h"
+#include "ds/hash_tables.h"
+#include "ds/linked_lists.h"
+
+using namespace std;
+
+template <class C>
+void printFootprint(string name, C &c){
+	cout << " " << name << ": " << c.bytesUsed() << " bytes used, " << c.bytesReserved()
+		<< " reserved, overhead ratio " << overheadRatio(c) << endl;
+}
+
+int main(){
+	cout << endl << "Testing memory accounting" << endl;
+	MemoryTally &tally = MemoryTally::instance();
+	long before = tally.bytes();
+
+	{
+		ArrayStack<int> as;
+		printFootprint("empty ArrayStack", as);
+		for (int i = 0; i < 1000; i++){
+			as.push(i);
+		}
+		printFootprint("ArrayStack with 1000", as);
+		while (as.size() > 400){
+			as.pop();
+		}
+		printFootprint("ArrayStack after popping down to 400", as);
+
+		ArrayDeque<int> ad;
+		for (int i = 0; i < 1000; i++){
+			ad.addLast(i);
+		}
+		printFootprint("ArrayDeque with 1000", ad);
+
+		DLList<int> dll;
+		for (int i = 0; i < 1000; i++){
+			dll.addLast(i);
+		}
+		printFootprint("DLList with 1000", dll);
+
+		Treap<int> t;
+		ScapegoatTree<int> sgt;
+		for (int i = 0; i < 1000; i++){
+			t.add(i);
+			sgt.add(i);
+		}
+		printFootprint("Treap with 1000", t);
+		printFootprint("ScapegoatTree with 1000", sgt);
+
+		SwissHashMap<int, int> m;
+		for (int i = 0; i < 1000; i++){
+			m.put(i, i);
+		}
+		printFootprint("SwissHashMap with 1000", m);
+
+		LRUCache<int, int> c(1000);
+		for (int i = 0; i < 1000; i++){
+			c.put(i, i);
+		}
+		printFootprint("LRUCache with 1000", c);
+
+		BloomFilter<int> bf(1000, 0.01);
+		BlockingQueue<int> bq(1024);
+		AdjacencyLists al(1000);
+		AdjacencyMatrix am(100);
+		for (int i = 0; i < 1000; i++){
+			bf.add(i);
+			bq.enqueue(i);
+			al.addEdge(i, (i + 1) % 1000);
+			am.addEdge(i % 100, i / 10);
+		}
+		CSRGraph csr(al);
+		printFootprint("BloomFilter with 1000", bf);
+		printFootprint("BlockingQueue with 1000", bq);
+		printFootprint("AdjacencyLists with 1000 edges", al);
+		printFootprint("AdjacencyMatrix with 1000 edges", am);
+		printFootprint("CSRGraph with 1000 edges", csr);
+
+		cout << " allocation tracking is on: " << tally.tracking() << endl;
+		cout << " containers hold at least their reserved bytes: "
+			<< (tally.bytes() - before >= as.bytesReserved() + ad.bytesReserved() + dll.bytesReserved()
+				+ t.bytesReserved() + sgt.bytesReserved() + m.bytesReserved() + c.bytesReserved()) << endl;
+	}
+	cout << " all freed once the containers are destroyed: " << (tally.bytes() == before) << endl;
+
+	long allocations = tally.allocations();
+	for (int k = 0; k < 1000; k++){
+		ArrayStack<int> s;
+		for (int i = 0; i < 10; i++){
+			s.push(i);
+		}
+	}
+	cout << " 1000 ArrayStacks of 10 values make " << tally.allocations() - allocations << " allocations" << endl;
+	allocations = tally.allocations();
+	for (int k = 0; k < 1000; k++){
+		ArrayStack<int, 16> s;
+		ArrayQueue<int, 16> q;
+		for (int i = 0; i < 10; i++){
+			s.push(i);
+			q.enqueue(i);
+		}
+	}
+	cout << " 1000 ArrayStack<int, 16>s and ArrayQueue<int, 16>s of 10 values make "
+		<< tally.allocations() - allocations << " allocations" << endl;
+	DualArrayDeque<int> dad;
+	ArrayDeque<int> ad;
+	dad.add(0, 0);
+	ad.add(0, 0);
+	for (int reserve = 0; reserve <= 100; reserve += 100){
+		dad.reserve(reserve);
+		ad.reserve(reserve);
+		long dadAllocations = tally.allocations();
+		for (int i = 0; i < 1000; i++){
+			dad.add(0, i);
+			dad.remove(0);
+		}
+		dadAllocations = tally.allocations() - dadAllocations;
+		allocations = tally.allocations();
+		for (int i = 0; i < 1000; i++){
+			ad.add(0, i);
+			ad.remove(0);
+		}
+		cout << " after reserve(" << reserve << "), 1000 add(0)/remove(0) pairs between sizes 1 and 2 make "
+			<< dadAllocations << " allocations in a DualArrayDeque and " << tally.allocations() - allocations
+			<< " in an ArrayDeque" << endl;
+	}
+	cout << " peak is at least the current count: " << (tally.peak() >= tally.bytes()) << endl;
+
+	return 0;
+}
@@ -0,0 +1,64 @@
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ds/skiplists.h"
+
+using namespace std;
+
+int main(){
+	cout << endl << "Testing ConcurrentSkiplistSSet" << endl;
+	ConcurrentSkiplistSSet<int> sl;
+
+	sl.add(8);
+	sl.add(3);
+	sl.add(4);
+	sl.add(10);
+	sl.add(9);
+	sl.add(12);
+	cout << " adding 9 again returns " << sl.add(9) << endl;
+	cout << " size is " << sl.size() << endl;
+
+	cout << "Next largest number to 7: " << sl.find(7) << endl;
+	cout << "Next largest number to 11: " << sl.find(11) << endl;
+	cout << "Next largest number to 8: " << sl.find(8) << endl;
+	try {
+		cout << "Next largest number to 13: " << sl.find(13) << endl;
+	} catch(std::out_of_range&){
+		cout << "There are no numbers larger than 13" << endl;
+	}
+
+	cout << "removing " << sl.remove(10) << ", size is now " << sl.size() << endl;
+	cout << "Next largest number to 10: " << sl.find(10) << endl;
+	try {
+		sl.remove(10);
+	} catch(std::out_of_range&){
+		cout << "10 has already been removed" << endl;
+	}
+
+	cout << "Testing with 4 threads:" << endl;
+	ConcurrentSkiplistSSet<int> shared;
+	vector<thread> threads;
+	for (int t = 0; t < 4; t++){
+		// Each thread adds the numbers 0-999 that are equal to t mod 4,
+		// and removes the even ones again
+		threads.push_back(thread([&shared, t](){
+			for (int i = t; i < 1000; i += 4){
+				shared.add(i);
+			}
+			for (int i = t; i < 1000; i += 4){
+				if (i % 2 == 0){
+					shared.remove(i);
+				}
+			}
+		}));
+	}
+	for (size_t t = 0; t < threads.size(); t++){
+		threads[t].join();
+	}
+	cout << " size is " << shared.size() << " (expected 500)" << endl;
+	cout << " next largest number to 500: " << shared.find(500) << " (expected 501)" << endl;
+
+	return 0;
+}
@@ -0,0 +1,103 @@
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+#include "ds/array_lists.h"
+#include "ds/binary_trees.h"
+#include "ds/linked_lists.h"
+#include "ds/snapshots.h"
+
+using namespace std;
+
+int main(){
+	const char* listPath = "/tmp/ods_list_spec.snap";
+	const char* setPath = "/tmp/ods_set_spec.snap";
+
+	cout << endl << "Testing ListView" << endl;
+	ArrayDeque<int> d;
+	for (int i = 0; i < 10; i++){
+		d.addFirst(i);
+	}
+	saveList(d, listPath);
+	ListView<int> lv(listPath);
+	cout << " saved an ArrayDeque of " << d.size() << ", view has size " << lv.size() << endl;
+	cout << " elements:";
+	for (int x : lv){
+		cout << " " << x;
+	}
+	cout << endl;
+	cout << " get(3) is " << lv.get(3) << endl;
+	try {
+		lv.get(10);
+		cout << " get(10) did not throw" << endl;
+	} catch(out_of_range &e){
+		cout << " get(10) throws: " << e.what() << endl;
+	}
+
+	DLList<int> dl;
+	for (int i = 0; i < 5; i++){
+		dl.addLast(i * i);
+	}
+	saveList(dl, listPath);
+	ListView<int> dlv(listPath);
+	cout << " saved a DLList, elements:";
+	for (int x : dlv){
+		cout << " " << x;
+	}
+	cout << endl;
+
+	cout << endl << "Testing SortedSetView" << endl;
+	RedBlackTree<int> t;
+	for (int i = 0; i < 15; i++){
+		t.add(3*i);
+	}
+	saveSortedSet(t, setPath);
+	SortedSetView<int> sv(setPath);
+	cout << " saved a RedBlackTree of " << t.size() << ", view has size " << sv.size() << endl;
+	cout << " find(0) is " << sv.find(0) << ", find(10) is " << sv.find(10)
+		<< ", find(42) is " << sv.find(42) << endl;
+	cout << " contains(9) is " << sv.contains(9) << ", contains(10) is " << sv.contains(10) << endl;
+	int mismatches = 0;
+	for (int x = -1; x <= 42; x++){
+		mismatches += sv.find(x) != t.find(x);
+	}
+	cout << " find(-1..42) differs from the tree " << mismatches << " times" << endl;
+	try {
+		sv.find(43);
+		cout << " find(43) did not throw" << endl;
+	} catch(out_of_range &e){
+		cout << " find(43) throws: " << e.what() << endl;
+	}
+
+	cout << endl << "Testing snapshot validation" << endl;
+	try {
+		SortedSetView<int> wrongLayout(listPath);
+		cout << " opening a list as a set did not throw" << endl;
+	} catch(runtime_error &e){
+		cout << " opening a list as a set throws: " << e.what() << endl;
+	}
+	try {
+		ListView<long> wrongType(listPath);
+		cout << " opening ints as longs did not throw" << endl;
+	} catch(runtime_error &e){
+		cout << " opening ints as longs throws: " << e.what() << endl;
+	}
+	try {
+		// n + 1 slots would wrap around to 0 and pass a naive length check
+		writeSnapshot(setPath, snapshotHeader(eytzingerLayout, sizeof(int), -1), nullptr, 0);
+		SortedSetView<int> corrupt(setPath);
+		cout << " opening a header claiming 2^64 - 1 values did not throw" << endl;
+	} catch(runtime_error &e){
+		cout << " opening a header claiming 2^64 - 1 values throws: " << e.what() << endl;
+	}
+	try {
+		ListView<int> missing("/tmp/ods_missing_spec.snap");
+		cout << " opening a missing file did not throw" << endl;
+	} catch(runtime_error &e){
+		cout << " opening a missing file throws: " << e.what() << endl;
+	}
+
+	remove(listPath);
+	remove(setPath);
+	return 0;
+}
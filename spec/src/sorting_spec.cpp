@@ -0,0 +1,114 @@
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+
+#include "ds/array_lists.h"
+#include "ds/sorting.h"
+
+using namespace std;
+
+template <class List>
+void fill(List &l){
+	int xs[] = {5, -3, 9, 1, 7, 3, 8, 0, -12, 3};
+	for (int i = 0; i < 10; i++){
+		l.add(l.size(), xs[i]);
+	}
+}
+
+template <class List>
+void print(string label, List &l){
+	cout << " " << label << ":";
+	for (int i = 0; i < l.size(); i++){
+		cout << " " << l.get(i);
+	}
+	cout << endl;
+}
+
+/**
+* Enough values for the parallel sorts to fork down to their grain size
+* on a multicore machine. The last few values are added at the front so
+* an ArrayDeque wraps around its backing array. The result is checked for order and
+* against quickSort on a copy.
+*/
+template <class List, class Sort>
+void checkLarge(string label, List &l, Sort sortRange){
+	int n = 200000;
+	for (int i = 0; i < n; i++){
+		l.add((i < n - 100) ? l.size() : 0, rand() % 100000 - 50000);
+	}
+	Array<int> expected(n);
+	for (int i = 0; i < n; i++){
+		expected[i] = l.get(i);
+	}
+	quickSort(&expected[0], n);
+
+	l.sort(sortRange);
+	bool sorted = true;
+	bool same = true;
+	for (int i = 0; i < n; i++){
+		sorted = sorted && (i == 0 || l.get(i-1) <= l.get(i));
+		same = same && l.get(i) == expected[i];
+	}
+	cout << " " << label << " of " << n << " values is sorted: " << (sorted ? "yes" : "no")
+		<< ", matches quickSort: " << (same ? "yes" : "no") << endl;
+}
+
+int main(){
+	srand(1);
+
+	cout << endl << "Testing ArrayStack" << endl;
+	ArrayStack<int> as;
+	fill(as);
+	as.sort(mergeSort<int>);
+	print("mergeSort", as);
+	as.add(0, 4);
+	as.sort(quickSort<int>);
+	print("add(0, 4) then quickSort", as);
+
+	cout << endl << "Testing FastArrayStack" << endl;
+	FastArrayStack<int> fas;
+	fill(fas);
+	fas.sort(radixSort<int>);
+	print("radixSort", fas);
+	fas.add(0, 4);
+	fas.sort(parallelRadixSort<int>);
+	print("add(0, 4) then parallelRadixSort", fas);
+
+	cout << endl << "Testing ArrayDeque" << endl;
+	ArrayDeque<int> ad;
+	fill(ad);
+	ad.removeFirst();
+	ad.removeFirst();
+	ad.addLast(6);
+	ad.addLast(-1);	// Wraps around the end of the backing array
+	ad.sort(parallelMergeSort<int>);
+	print("removeFirst() twice, addLast(6), addLast(-1) then parallelMergeSort", ad);
+
+	cout << endl << "Testing DualArrayDeque" << endl;
+	DualArrayDeque<int> dad;
+	fill(dad);
+	dad.add(0, 4);
+	dad.sort(quickSort<int>);
+	print("add(0, 4) then quickSort", dad);
+
+	cout << endl << "Testing countingSort" << endl;
+	ArrayStack<int> digits;
+	for (int i = 0; i < 10; i++){
+		digits.push((7*i + 3) % 10);
+	}
+	print("before", digits);
+	digits.sort([](int* a, int n){ countingSort(a, n, 10); });
+	print("after", digits);
+
+	cout << endl << "Testing the parallel sorts on large lists" << endl;
+	ArrayStack<int> bigStack;
+	checkLarge("ArrayStack parallelMergeSort", bigStack, parallelMergeSort<int>);
+	FastArrayStack<int> bigFast;
+	checkLarge("FastArrayStack parallelRadixSort", bigFast, parallelRadixSort<int>);
+	ArrayDeque<int> bigDeque;
+	checkLarge("ArrayDeque parallelMergeSort", bigDeque, parallelMergeSort<int>);
+	DualArrayDeque<int> bigDual;
+	checkLarge("DualArrayDeque parallelRadixSort", bigDual, parallelRadixSort<int>);
+
+	return 0;
+}
@@ -0,0 +1,30 @@
+#include <iostream>
+#include <stdexcept>
+
+#include "ds/tries.h"
+
+using namespace std;
+
+#include "./helpers/sets/sortedset_check.cpp"
+
+int main(){
+	cout << endl << "Testing BinaryTrie" << endl;
+	BinaryTrie<unsigned> bt;
+	sortedSetCheck(bt);
+
+	cout << endl << "Testing XFastTrie" << endl;
+	XFastTrie<unsigned> xft;
+	sortedSetCheck(xft);
+
+	cout << endl << "Testing YFastTrie" << endl;
+	YFastTrie<unsigned> yft;
+	sortedSetCheck(yft);
+
+	cout << endl << "Testing YFastTrie with 64-bit keys" << endl;
+	YFastTrie<unsigned long long> big;
+	big.add(1ull << 40);
+	big.add(1ull << 60);
+	cout << " find(2^40 + 1) returns " << big.find((1ull << 40) + 1) << endl;
+
+	return 0;
+}
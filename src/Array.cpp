@@ -15,32 +15,96 @@
 * This structure is used internally by several List and Queue implementations.
 *
 * std::array provides similar benefits.
+*
+* With N > 0 the first N slots live inside the Array object, and the
+* heap is only used once more than N are asked for. An Array that fits
+* is never shorter than N, since the inline slots are there anyway:
+*
+*   Array<int, 4> a;       4 inline slots, no allocation
+*   Array<int, 4> b(3);    still 4 inline slots
+*   Array<int, 4> c(10);   10 slots on the heap
+*
+* Containers that hold a handful of elements, eg short lived stacks,
+* then never call malloc at all. The cost is N slots of space in the
+* container even when the data has spilled to the heap.
 */
 
-template <class T>
-Array<T>::Array() {
-	a = new T[1];
-	l = 1;
+template <class T, int N>
+Array<T, N>::Array() {
+	if (N > 0){
+		a = this->inlineSlots();
+		l = N;
+	} else {
+		a = new T[1];
+		l = 1;
+	}
 }
 
-template <class T>
-Array<T>::Array(int len) {
-	a = new T[len];
-	l = len;
+template <class T, int N>
+Array<T, N>::Array(int len) {
+	if (N > 0 && len <= N){
+		a = this->inlineSlots();
+		l = N;
+	} else {
+		a = new T[len];
+		l = len;
+	}
 }
 
-template <class T>
-Array<T>::~Array() {
-	delete[] a;
+template <class T, int N>
+Array<T, N>::~Array() {
+	if (!isInline()) delete[] a;
 }
 
-// Copy constructor
-template <class T>
-Array<T>& Array<T>::operator=(Array<T> &b){
-	if (a != nullptr) delete[] a;
-	a = b.a;
-	b.a = nullptr;
+/**
+* Takes b's heap array if it has one. Inline slots can't be handed
+* over, so their elements are moved into this Array's own slots.
+* Copying is not allowed: a copy would share b's heap array, and both
+* would delete it, or point into b's inline slots.
+*
+* b is left usable, so a container moved from can still index its
+* array: it keeps or falls back to its inline slots, and without
+* them gets a new array of length 1, as the default constructor does.
+* Assignment avoids the allocation by giving b this Array's old heap
+* array instead.
+*/
+template <class T, int N>
+Array<T, N>::Array(Array<T, N> &&b) {
 	l = b.l;
+	if (b.isInline()){
+		a = this->inlineSlots();
+		this->moveIntoSlots(b.a, b.l);
+	} else {
+		a = b.a;
+		if (N > 0){
+			b.a = b.inlineSlots();
+			b.l = N;
+		} else {
+			b.a = new T[1];
+			b.l = 1;
+		}
+	}
+}
+
+template <class T, int N>
+Array<T, N>& Array<T, N>::operator=(Array<T, N> &&b){
+	if (this == &b){
+		return *this;
+	}
+	if (b.isInline()){
+		if (!isInline()) delete[] a;
+		a = this->inlineSlots();
+		l = b.l;
+		this->moveIntoSlots(b.a, b.l);
+	} else if (isInline()){
+		a = b.a;
+		l = b.l;
+		b.a = b.inlineSlots();
+		b.l = N;
+	} else {
+		std::swap(a, b.a);
+		std::swap(l, b.l);
+	}
 	return *this;
 }
 
@@ -50,8 +114,8 @@ Array<T>& Array<T>::operator=(Array<T> &b){
 * in a C-style array, pointer artithmetic can also be used to move between elements.
 * FastArrayStack::resize shows an example of this.
 */
-template <class T>
-T& Array<T>::operator[](int i) {
+template <class T, int N>
+T& Array<T, N>::operator[](int i) {
 	if (i >= 0 && i < l){
 		return a[i];
 	} else {
@@ -63,13 +127,18 @@ T& Array<T>::operator[](int i) {
 * Instantiating classes should be able to query the length value
 * but not change it.
 */
-template <class T>
-int Array<T>::length(){
+template <class T, int N>
+int Array<T, N>::length(){
 	return l;
 }
 
-template <class T>
-std::string Array<T>::draw(){
+template <class T, int N>
+bool Array<T, N>::isInline(){
+	return N > 0 && a == this->inlineSlots();
+}
+
+template <class T, int N>
+std::string Array<T, N>::draw(){
 	std::stringstream ss;
 	for (int i = 0; i < l; i++){
 		ss << a[i] << " ";
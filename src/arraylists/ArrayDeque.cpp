@@ -34,6 +34,10 @@
 *    add(i,x): O(min(i,n-i)), ie at worst half the array will need to be moved
 *      remove: O(min(i,n-i)), ie at worst half the array will need to be moved
 */
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
 #include "ds/array_lists.h"
 
 // Copy-pasted from ArrayQueue.
@@ -44,7 +48,7 @@ int ArrayDeque<T>::size(){
 
 
 template <class T>
-T ArrayDeque<T>::get(int i){
+const T& ArrayDeque<T>::get(int i){
 	return this->a[(this->j+i) % this->a.length()];
 }
 
@@ -52,8 +56,8 @@ T ArrayDeque<T>::get(int i){
 template <class T>
 T ArrayDeque<T>::set(int i, T x){
 	int index = (this->j+i) % this->a.length();
-	T y = this->a[index];
-	this->a[index] = x;
+	T y = std::move(this->a[index]);
+	this->a[index] = std::move(x);
 	return y;
 }
 
@@ -64,18 +68,20 @@ T ArrayDeque<T>::set(int i, T x){
 */
 template <class T>
 void ArrayDeque<T>::add(int i, T x){
-	if (this->n+1 > this->a.length()) this->resize();
+	if (this->n+1 > this->a.length()) this->resize(std::max(2*this->n, 1));
 	if (i < this->n/2){
+		this->shifted(i);
 		this->j = (this->j==0) ? this->a.length() -1 : this->j-1;
 		for (int k=0; k <= i-1; k++){
-			this->a[(this->j+k) % this->a.length()] = this->a[(this->j+k+1) % this->a.length()];
+			this->a[(this->j+k) % this->a.length()] = std::move(this->a[(this->j+k+1) % this->a.length()]);
 		}
 	} else {
+		this->shifted(this->n - i);
 		for (int k=this->n; k > i; k--){
-			this->a[(this->j+k) % this->a.length()] = this->a[(this->j+k-1) & this->a.length()];
+			this->a[(this->j+k) % this->a.length()] = std::move(this->a[(this->j+k-1) % this->a.length()]);
 		}
 	}
-	this->a[(this->j+i) % this->a.length()] = x;
+	this->a[(this->j+i) % this->a.length()] = std::move(x);
 	this->n++;
 }
 
@@ -86,19 +92,21 @@ void ArrayDeque<T>::add(int i, T x){
 */
 template <class T>
 T ArrayDeque<T>::remove(int i){
-	T x = this->a[(this->j+i) % this->a.length()];
+	T x = std::move(this->a[(this->j+i) % this->a.length()]);
 	if (i < this->n/2) {
+		this->shifted(i);
 		for (int k = i; k >0; k--){
-			this->a[(this->j+k) % this->a.length()] = this->a[(this->j+k-1) % this->a.length()];
+			this->a[(this->j+k) % this->a.length()] = std::move(this->a[(this->j+k-1) % this->a.length()]);
 		}
 		this->j = (this->j+1) % this->a.length();
 	} else {
+		this->shifted(this->n - i - 1);
 		for (int k = i; k < this->n-1; k++){
-			this->a[(this->j+k) % this->a.length()] = this->a[(this->j+k+1) % this->a.length()];
+			this->a[(this->j+k) % this->a.length()] = std::move(this->a[(this->j+k+1) % this->a.length()]);
 		}
 	}
 	this->n--;
-	if (3*this->n < this->a.length()) this->resize();
+	if (this->policy.shrinks(this->a.length(), this->n)) this->resize(this->policy.shrunkLength(this->n));
 
 	return x;
 }
@@ -106,7 +114,7 @@ T ArrayDeque<T>::remove(int i){
 
 template <class T>
 void ArrayDeque<T>::addLast(T x){
-	add(this->n, x);
+	add(this->n, std::move(x));
 }
 
 
@@ -118,7 +126,7 @@ T ArrayDeque<T>::removeLast(){
 
 template <class T>
 void ArrayDeque<T>::addFirst(T x){
-	add(0, x);
+	add(0, std::move(x));
 }
 
 
@@ -130,7 +138,7 @@ T ArrayDeque<T>::removeFirst(){
 
 template <class T>
 void ArrayDeque<T>::push(T x){
-	addFirst(x);
+	addFirst(std::move(x));
 }
 
 template <class T>
@@ -138,3 +146,128 @@ T ArrayDeque<T>::pop(){
 	return removeFirst();
 }
 
+/**
+* The sorting algorithms need the elements to be contiguous. If they
+* wrap around the end of the backing array, the array is rotated
+* in place so that they start at index 0:
+*
+*   d e _ _ a b c  (j=4)  rotate
+*   a b c d e _ _  (j=0)
+*/
+template <class T>
+template <class Sort>
+void ArrayDeque<T>::sort(Sort sortRange){
+	T* a = &this->a[0];
+	int length = this->a.length();
+	if (this->j + this->n > length){
+		std::rotate(a, a + this->j, a + length);
+		this->j = 0;
+	}
+	sortRange(a + this->j, this->n);
+}
+
+
+/**
+* The elements run from j to the end of the backing array, then wrap
+* around to the start, so each scan covers (up to) two segments:
+*
+*   d e _ _ a b c  (j=4)  scan a b c, then d e
+*
+* indexOf only looks at the second segment if x isn't in the first.
+*/
+template <class T>
+int ArrayDeque<T>::indexOf(const T& x){
+	T* a = &this->a[0];
+	int k = std::min(this->n, this->a.length() - this->j);	// Elements before the wrap
+	int i = scanIndexOf(a + this->j, k, x);
+	if (i >= 0 || k == this->n){
+		return i;
+	}
+	i = scanIndexOf(a, this->n - k, x);
+	return (i < 0) ? -1 : k + i;
+}
+
+template <class T>
+bool ArrayDeque<T>::contains(const T& x){
+	return indexOf(x) >= 0;
+}
+
+template <class T>
+int ArrayDeque<T>::count(const T& x){
+	T* a = &this->a[0];
+	int k = std::min(this->n, this->a.length() - this->j);
+	return scanCount(a + this->j, k, x) + scanCount(a, this->n - k, x);
+}
+
+template <class T>
+T ArrayDeque<T>::min(){
+	if (this->n == 0){
+		throw std::out_of_range("list is empty");
+	}
+	T* a = &this->a[0];
+	int k = std::min(this->n, this->a.length() - this->j);
+	T m = scanMin(a + this->j, k);
+	return (k == this->n) ? m : std::min(m, scanMin(a, this->n - k));
+}
+
+template <class T>
+T ArrayDeque<T>::max(){
+	if (this->n == 0){
+		throw std::out_of_range("list is empty");
+	}
+	T* a = &this->a[0];
+	int k = std::min(this->n, this->a.length() - this->j);
+	T m = scanMax(a + this->j, k);
+	return (k == this->n) ? m : std::max(m, scanMax(a, this->n - k));
+}
+
+template <class T>
+typename ScanSum<T>::type ArrayDeque<T>::sum(){
+	T* a = &this->a[0];
+	int k = std::min(this->n, this->a.length() - this->j);
+	return scanSum(a + this->j, k) + scanSum(a, this->n - k);
+}
+
+
+/**
+* As with the scans, the parallel algorithms run over the part before
+* the wrap and then the part after it. reduce and inclusiveScan carry
+* the result of the first part into the second.
+*/
+template <class T>
+template <class F>
+void ArrayDeque<T>::forEach(F f){
+	T* a = &this->a[0];
+	int k = std::min(this->n, this->a.length() - this->j);
+	parallelForEach(a + this->j, k, f);
+	parallelForEach(a, this->n - k, f);
+}
+
+template <class T>
+template <class F>
+void ArrayDeque<T>::transform(F f){
+	T* a = &this->a[0];
+	int k = std::min(this->n, this->a.length() - this->j);
+	parallelTransform(a + this->j, k, f);
+	parallelTransform(a, this->n - k, f);
+}
+
+template <class T>
+template <class S, class Op>
+S ArrayDeque<T>::reduce(S init, Op op){
+	T* a = &this->a[0];
+	int k = std::min(this->n, this->a.length() - this->j);
+	S r = parallelReduce(a + this->j, k, init, op);
+	return parallelReduce(a, this->n - k, r, op);
+}
+
+template <class T>
+template <class Op>
+void ArrayDeque<T>::inclusiveScan(Op op){
+	T* a = &this->a[0];
+	int k = std::min(this->n, this->a.length() - this->j);
+	parallelInclusiveScan(a + this->j, k, op);
+	if (k < this->n){
+		parallelInclusiveScan(a, this->n - k, op, a[this->j + k - 1]);
+	}
+}
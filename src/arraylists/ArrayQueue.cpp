@@ -49,44 +49,118 @@
 *    enqueue(x): O(1)
 *    dequeue(): O(1)
 */
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
 #include "ds/array_lists.h"
 
 
+/**
+* Copying isn't allowed, see Array. Moving hands over b's elements and
+* leaves it an empty queue.
+*/
+template <class T, int N>
+ArrayQueue<T, N>::ArrayQueue(ArrayQueue<T, N> &&b):
+	Counters<Instrumented<ArrayQueue<T, N> >::value>(b), a(std::move(b.a)), j(b.j), n(b.n), policy(b.policy) {
+	b.j = 0;
+	b.n = 0;
+}
+
+template <class T, int N>
+ArrayQueue<T, N>& ArrayQueue<T, N>::operator=(ArrayQueue<T, N> &&b){
+	if (this != &b){
+		a = std::move(b.a);
+		j = b.j;
+		n = b.n;
+		policy = b.policy;
+		b.j = 0;
+		b.n = 0;
+	}
+	return *this;
+}
+
 /**
 * During resizing, j is reset to 0 and the first data element will
 * be moved to the beginning of the new backing array
 */
-template <class T>
-void ArrayQueue<T>::resize(){
-	Array<T> b(std::max(1, 2*n));
+template <class T, int N>
+void ArrayQueue<T, N>::resize(int length){
+	Array<T, N> b(length);
 	for (int k=0; k < n; k++){
-		b[k] = a[(j+k) % a.length()];
+		b[k] = std::move(a[(j+k) % a.length()]);
 	}
-	a = b;
+	a = std::move(b);
 	j = 0;
+	this->resized(n);
 }
 
 
-template <class T>
-int ArrayQueue<T>::size(){
+template <class T, int N>
+int ArrayQueue<T, N>::size(){
 	return n;
 }
 
 
-template <class T>
-void ArrayQueue<T>::enqueue(T x){
-	if (n+1 > a.length()) resize();
-	a[(j+n) % a.length()] = x;
+template <class T, int N>
+void ArrayQueue<T, N>::enqueue(T x){
+	if (n+1 > a.length()) resize(std::max(2*n, 1));
+	a[(j+n) % a.length()] = std::move(x);
 	n++;
 }
 
 
-template <class T>
-T ArrayQueue<T>::dequeue(){
-	// What if the queue is empty?
-	T x = a[j];
+template <class T, int N>
+T ArrayQueue<T, N>::dequeue(){
+	if (n == 0){
+		throw std::out_of_range("queue is empty");
+	}
+	T x = std::move(a[j]);
 	j = (j+1) % a.length();
 	n--;
-	if (a.length() >= 3*n) resize();
+	if (a.length() > N && policy.shrinks(a.length(), n)) resize(policy.shrunkLength(n));
 	return x;
 }
+
+
+template <class T, int N>
+int ArrayQueue<T, N>::capacity(){
+	return a.length();
+}
+
+template <class T, int N>
+void ArrayQueue<T, N>::reserve(int m){
+	if (m > a.length()) resize(m);
+}
+
+template <class T, int N>
+void ArrayQueue<T, N>::shrinkToFit(){
+	if (a.length() > std::max(std::max(n, 1), N)) resize(std::max(n, 1));
+}
+
+template <class T, int N>
+ShrinkPolicy ArrayQueue<T, N>::shrinkPolicy(){
+	return policy;
+}
+
+template <class T, int N>
+void ArrayQueue<T, N>::setShrinkPolicy(ShrinkPolicy p){
+	policy = p;
+}
+
+
+template <class T, int N>
+OpStats ArrayQueue<T, N>::stats(){
+	return this->counts();
+}
+
+
+template <class T, int N>
+long ArrayQueue<T, N>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T, int N>
+long ArrayQueue<T, N>::bytesReserved(){
+	return (long)a.length() * sizeof(T);
+}
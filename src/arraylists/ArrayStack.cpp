@@ -22,13 +22,38 @@
 * std::vector provides similar benefits.
 */
 
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
 #include "ds/array_lists.h"
 
 
+/**
+* Copying isn't allowed, see Array. Moving hands over b's elements and
+* leaves it an empty stack.
+*/
+template <class T, int N>
+ArrayStack<T, N>::ArrayStack(ArrayStack<T, N> &&b):
+	Counters<Instrumented<ArrayStack<T, N> >::value>(b), a(std::move(b.a)), n(b.n), policy(b.policy) {
+	b.n = 0;
+}
+
+template <class T, int N>
+ArrayStack<T, N>& ArrayStack<T, N>::operator=(ArrayStack<T, N> &&b){
+	if (this != &b){
+		a = std::move(b.a);
+		n = b.n;
+		policy = b.policy;
+		b.n = 0;
+	}
+	return *this;
+}
+
 /**
 * Since the underlying array can't change size,
-* a new array is created that has enough room to
-* hold twice the current number of elements.
+* a new array is created with room for length elements,
+* and the current elements are copied into it.
 *
 * Data stored in the old Array will be released
 * by its destructor.
@@ -37,65 +62,68 @@
 * run on every call to add/remove it has little effect on the
 * average operation, and the amortized cost for m operations is O(1).
 */
-template <class T>
-void ArrayStack<T>::resize(){
-	Array<T> b(std::max(2*n, 1));
+template <class T, int N>
+void ArrayStack<T, N>::resize(int length){
+	Array<T, N> b(length);
 	for (int i=0; i < n; i++){
-		b[i] = a[i];
+		b[i] = std::move(a[i]);
 	}
-	a = b;
+	a = std::move(b);
+	this->resized(n);
 }
 
-template <class T>
-int ArrayStack<T>::size(){
+template <class T, int N>
+int ArrayStack<T, N>::size(){
 	return n;
 }
 
 /**
 * Bounds checking is handled by the backing array
 */
-template <class T>
-T ArrayStack<T>::get(int i){
+template <class T, int N>
+const T& ArrayStack<T, N>::get(int i){
 	return a[i];
 }
 
 /**
 * Bounds checking is handled by the backing array
 */
-template <class T>
-T ArrayStack<T>::set(int i, T x){
-	T y = a[i];
-    a[i] = x;
-    return y;
+template <class T, int N>
+T ArrayStack<T, N>::set(int i, T x){
+	T y = std::move(a[i]);
+	a[i] = std::move(x);
+	return y;
 }
 
 /**
 * If there is no room for the new element, the underlying array will be resized.
 */
-template <class T>
-void ArrayStack<T>::add(int i, T x){
-	if (n+1 > a.length()) resize();
+template <class T, int N>
+void ArrayStack<T, N>::add(int i, T x){
+	if (n+1 > a.length()) resize(std::max(2*n, 1));
+	this->shifted(n - i);
 	for (int j = n; j > i; j--) {
-		a[j] = a[j-1];
+		a[j] = std::move(a[j-1]);
 	}
-	a[i] = x;
+	a[i] = std::move(x);
 	n++;
 }
 
 
 /**
-* If the removal operation leaves the array three times larger than necessary
-* it will be resized to be twice as large as necessary, freeing up memory
-* but leaving room for expansion.
+* If the removal operation leaves the array much larger than necessary
+* (see ShrinkPolicy) it will be resized to be twice as large as necessary,
+* freeing up memory but leaving room for expansion.
 */
-template <class T>
-T ArrayStack<T>::remove(int i){
-	T x = a[i];
+template <class T, int N>
+T ArrayStack<T, N>::remove(int i){
+	T x = std::move(a[i]);
+	this->shifted(n - i - 1);
 	for (int j = i; j < n-1; j++){
-		a[j] = a[j+1];
+		a[j] = std::move(a[j+1]);
 	}
 	n--;
-	if (a.length() >= 3*n) resize();
+	if (a.length() > N && policy.shrinks(a.length(), n)) resize(policy.shrunkLength(n));
 
 	return x;
 }
@@ -105,12 +133,148 @@ T ArrayStack<T>::remove(int i){
 * Stack push method can be efficiently implemented by adding the
 * new element at the end of the array.
 */
-template <class T>
-void ArrayStack<T>::push(T x){
-	add(n, x);
+template <class T, int N>
+void ArrayStack<T, N>::push(T x){
+	add(n, std::move(x));
 }
 
-template <class T>
-T ArrayStack<T>::pop(){
+template <class T, int N>
+T ArrayStack<T, N>::pop(){
 	return remove(n-1);
 }
+
+
+template <class T, int N>
+int ArrayStack<T, N>::capacity(){
+	return a.length();
+}
+
+/**
+* Pre-sizing for a bulk load means the array is allocated once,
+* rather than log(m) times with every element copied along the way.
+* The shrink policy still applies to later removals.
+*/
+template <class T, int N>
+void ArrayStack<T, N>::reserve(int m){
+	if (m > a.length()) resize(m);
+}
+
+template <class T, int N>
+void ArrayStack<T, N>::shrinkToFit(){
+	if (a.length() > std::max(std::max(n, 1), N)) resize(std::max(n, 1));
+}
+
+template <class T, int N>
+ShrinkPolicy ArrayStack<T, N>::shrinkPolicy(){
+	return policy;
+}
+
+template <class T, int N>
+void ArrayStack<T, N>::setShrinkPolicy(ShrinkPolicy p){
+	policy = p;
+}
+
+/**
+* Sorts the backing array directly, eg
+*   as.sort(mergeSort<int>);
+* See ds/sorting.h for the available algorithms.
+*/
+template <class T, int N>
+template <class Sort>
+void ArrayStack<T, N>::sort(Sort sortRange){
+	sortRange(&a[0], n);
+}
+
+
+/**
+* These run over &a[0]..&a[n-1] directly, eg
+*   as.indexOf(42);
+* See ds/scans.h for which element types have SIMD versions.
+*/
+template <class T, int N>
+int ArrayStack<T, N>::indexOf(const T& x){
+	return scanIndexOf(&a[0], n, x);
+}
+
+template <class T, int N>
+bool ArrayStack<T, N>::contains(const T& x){
+	return indexOf(x) >= 0;
+}
+
+template <class T, int N>
+int ArrayStack<T, N>::count(const T& x){
+	return scanCount(&a[0], n, x);
+}
+
+template <class T, int N>
+T ArrayStack<T, N>::min(){
+	if (n == 0){
+		throw std::out_of_range("list is empty");
+	}
+	return scanMin(&a[0], n);
+}
+
+template <class T, int N>
+T ArrayStack<T, N>::max(){
+	if (n == 0){
+		throw std::out_of_range("list is empty");
+	}
+	return scanMax(&a[0], n);
+}
+
+template <class T, int N>
+typename ScanSum<T>::type ArrayStack<T, N>::sum(){
+	return scanSum(&a[0], n);
+}
+
+
+/**
+* Each of these runs over &a[0]..&a[n-1] on several threads, eg
+*   as.transform([](int x){ return 2*x; });
+* See ds/parallel.h.
+*/
+template <class T, int N>
+template <class F>
+void ArrayStack<T, N>::forEach(F f){
+	parallelForEach(&a[0], n, f);
+}
+
+template <class T, int N>
+template <class F>
+void ArrayStack<T, N>::transform(F f){
+	parallelTransform(&a[0], n, f);
+}
+
+template <class T, int N>
+template <class S, class Op>
+S ArrayStack<T, N>::reduce(S init, Op op){
+	return parallelReduce(&a[0], n, init, op);
+}
+
+template <class T, int N>
+template <class Op>
+void ArrayStack<T, N>::inclusiveScan(Op op){
+	parallelInclusiveScan(&a[0], n, op);
+}
+
+
+template <class T, int N>
+OpStats ArrayStack<T, N>::stats(){
+	return this->counts();
+}
+
+
+/**
+* Shows the slack left by resize(): the array is 2n after a resize,
+* and up to factor*n just before remove() shrinks it. Inline slots
+* count as reserved too, although they are part of the stack itself.
+*/
+template <class T, int N>
+long ArrayStack<T, N>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T, int N>
+long ArrayStack<T, N>::bytesReserved(){
+	return (long)a.length() * sizeof(T);
+}
@@ -11,11 +11,9 @@
 * In the last operation, the removal of element 'a' caused a rebalancing to
 * ensure data is evenly split between the two ArrayStacks.
 *
-* In order to preserve the encapsulation of the data within the ArrayStacks,
-* this implementation differs from that presented by Morin in that the balancing
-* operation calls ArrayStack::add rather than directly writing to the array.
-* As long as those calls are made such that the backing array grows at the end,
-* this shouldn't affect performance.
+* As in Morin's version, balancing moves elements between the two
+* backing arrays directly rather than through ArrayStack::add, so it
+* takes O(n) moves and only allocates if the receiving array is full.
 *
 * Performance:
 *
@@ -25,35 +23,76 @@
 *      remove: O(min(i,n-i)), ie at worst half the array will need to be moved
 */
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
 #include "ds/array_lists.h"
 
 /**
 * If one of the ArrayStacks contains 3 or more times as much data as the other,
-* move the data into two new ArrayStacks such that it is evenly distributed.
+* move elements from the bottom of the fuller one to the bottom of the other,
+* so that the data is evenly distributed.
+*
+*   a | b c d e f    balance()    a b c | d e f
+*
+* The receiving array grows to the room the shrink policy would leave
+* it, and the giving array shrinks if the policy says so, so balancing
+* never keeps capacity the policy would give back. The exception is an
+* explicit reserve(m): each stack keeps room for half of m until the
+* policy would shrink an array of length m holding n elements, just as
+* removals release an ArrayStack's reservation.
+*
+* Below 2 elements one half is always empty, and there is nothing to
+* even out, so alternating add and remove there never rebalances.
 */
 template <class T>
 void DualArrayDeque<T>::balance(){
+	int n = front.size() + back.size();
+	if (n < 2){
+		return;
+	}
 	if (3 * front.size() < back.size() || 3 * back.size() < front.size()){
-		// New stacks - could have memory implications if data set is large
-		ArrayStack<T> af2;
-		ArrayStack<T> ab2;
-
-		int n = front.size() + back.size();
-
+		ShrinkPolicy policy = front.shrinkPolicy();
+		if (policy.shrinks(reserved, n)){
+			reserved = 0;
+		}
 		int nf = n/2;
-		// Consider looping backwards to avoid shifting data
-		for (int i = 0; i < nf; i++){
-			af2.add(nf - i - 1, get(i));
+		if (front.size() < nf){
+			moveBottom(back, front, nf - front.size());
+		} else {
+			moveBottom(front, back, front.size() - nf);
 		}
+		this->balanced(n);
+	}
+}
 
-		int nb = n - nf;
-		// New data is added to end of array so should be fast
-		for (int i = 0; i < nb; i++){
-			ab2.add(i, get(nf+i));
-		}
+/**
+* Moves the k elements at the bottom of from's array onto the bottom of
+* to's. Each half has the middle of the list at its bottom, front
+* running backwards, so the k elements swap order on the way across.
+*/
+template <class T>
+void DualArrayDeque<T>::moveBottom(ArrayStack<T> &from, ArrayStack<T> &to, int k){
+	ShrinkPolicy policy = to.shrinkPolicy();
+	int half = (reserved + 1) / 2;
+	int m = to.n + k;
+	if (m > to.a.length()){
+		to.resize(std::max((int)policy.shrunkLength(m), half));
+	}
+
+	T* t = &to.a[0];
+	T* f = &from.a[0];
+	std::move_backward(t, t + to.n, t + m);
+	for (int p = 0; p < k; p++){
+		t[p] = std::move(f[k - 1 - p]);
+	}
+	std::move(f + k, f + from.n, f);
+	to.n = m;
+	from.n -= k;
 
-		front = af2;
-		back = ab2;
+	if (policy.shrinks(from.a.length(), from.n) && std::max((int)policy.shrunkLength(from.n), half) < from.a.length()){
+		from.resize(std::max((int)policy.shrunkLength(from.n), half));
 	}
 }
 
@@ -65,7 +104,7 @@ int DualArrayDeque<T>::size(){
 
 
 template <class T>
-T DualArrayDeque<T>::get(int i){
+const T& DualArrayDeque<T>::get(int i){
 	if (i < front.size()) {
 		return front.get(front.size() - i - 1);
 	} else {
@@ -77,9 +116,9 @@ T DualArrayDeque<T>::get(int i){
 template <class T>
 T DualArrayDeque<T>::set(int i, T x){
 	if (i < front.size()) {
-		return front.set(front.size() - i -1, x);
+		return front.set(front.size() - i -1, std::move(x));
 	} else {
-		return back.set(i - front.size(), x);
+		return back.set(i - front.size(), std::move(x));
 	}
 }
 
@@ -87,9 +126,9 @@ T DualArrayDeque<T>::set(int i, T x){
 template <class T>
 void DualArrayDeque<T>::add(int i, T x){
 	if (i < front.size()){
-		front.add(front.size() - i, x);
+		front.add(front.size() - i, std::move(x));
 	} else {
-		back.add(i - front.size(), x);
+		back.add(i - front.size(), std::move(x));
 	}
 	balance();
 }
@@ -107,3 +146,126 @@ T DualArrayDeque<T>::remove(int i){
 	return x;
 }
 
+
+template <class T>
+int DualArrayDeque<T>::capacity(){
+	return front.capacity() + back.capacity();
+}
+
+/**
+* Either end might grow, so each half gets room for half of m, and
+* balance() keeps the reservation until enough elements have been
+* removed for the shrink policy to apply. One half can hold up to 3/4 of
+* the elements, so it may still resize once before m is reached.
+*/
+template <class T>
+void DualArrayDeque<T>::reserve(int m){
+	reserved = std::max(reserved, m);
+	int half = (m + 1) / 2;
+	front.reserve(std::max(half, front.size()));
+	back.reserve(std::max(half, back.size()));
+}
+
+template <class T>
+void DualArrayDeque<T>::shrinkToFit(){
+	reserved = 0;
+	front.shrinkToFit();
+	back.shrinkToFit();
+}
+
+template <class T>
+ShrinkPolicy DualArrayDeque<T>::shrinkPolicy(){
+	return front.shrinkPolicy();
+}
+
+template <class T>
+void DualArrayDeque<T>::setShrinkPolicy(ShrinkPolicy p){
+	front.setShrinkPolicy(p);
+	back.setShrinkPolicy(p);
+}
+
+/**
+* The elements are split between two arrays, and front holds its half
+* in reverse, so they are moved into one array, sorted, and moved
+* back in order.
+*/
+template <class T>
+template <class Sort>
+void DualArrayDeque<T>::sort(Sort sortRange){
+	int n = size();
+	if (n < 2){
+		return;
+	}
+	Array<T> b(n);
+	int nf = front.size();
+	for (int i = 0; i < nf; i++){
+		b[i] = front.set(nf - i - 1, T());
+	}
+	for (int i = nf; i < n; i++){
+		b[i] = back.set(i - nf, T());
+	}
+	sortRange(&b[0], n);
+	for (int i = 0; i < nf; i++){
+		front.set(nf - i - 1, std::move(b[i]));
+	}
+	for (int i = nf; i < n; i++){
+		back.set(i - nf, std::move(b[i]));
+	}
+}
+
+
+/**
+* front holds its half in reverse, so reduce and inclusiveScan read it
+* through a reverse iterator, from its last element to its first, and
+* carry on into back. forEach and transform don't depend on the order.
+*/
+template <class T>
+template <class F>
+void DualArrayDeque<T>::forEach(F f){
+	parallelForEach(&front.a[0], front.n, f);
+	parallelForEach(&back.a[0], back.n, f);
+}
+
+template <class T>
+template <class F>
+void DualArrayDeque<T>::transform(F f){
+	parallelTransform(&front.a[0], front.n, f);
+	parallelTransform(&back.a[0], back.n, f);
+}
+
+template <class T>
+template <class S, class Op>
+S DualArrayDeque<T>::reduce(S init, Op op){
+	std::reverse_iterator<T*> f(&front.a[0] + front.n);
+	S r = parallelReduce(f, front.n, init, op);
+	return parallelReduce(&back.a[0], back.n, r, op);
+}
+
+template <class T>
+template <class Op>
+void DualArrayDeque<T>::inclusiveScan(Op op){
+	std::reverse_iterator<T*> f(&front.a[0] + front.n);
+	parallelInclusiveScan(f, front.n, op);
+	if (front.n == 0){
+		parallelInclusiveScan(&back.a[0], back.n, op);
+	} else {
+		parallelInclusiveScan(&back.a[0], back.n, op, front.a[0]);
+	}
+}
+
+
+template <class T>
+OpStats DualArrayDeque<T>::stats(){
+	return this->counts();
+}
+
+
+template <class T>
+long DualArrayDeque<T>::bytesUsed(){
+	return front.bytesUsed() + back.bytesUsed();
+}
+
+template <class T>
+long DualArrayDeque<T>::bytesReserved(){
+	return front.bytesReserved() + back.bytesReserved();
+}
@@ -3,13 +3,39 @@
 * features for efficient movement of data.
 */
 
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
 #include "ds/array_lists.h"
 
+/**
+* As for ArrayStack, moving hands over b's elements and leaves it an
+* empty stack.
+*/
+template <class T>
+FastArrayStack<T>::FastArrayStack(FastArrayStack<T> &&b):
+	Counters<Instrumented<FastArrayStack<T> >::value>(b), a(std::move(b.a)), n(b.n), policy(b.policy) {
+	b.n = 0;
+}
+
+template <class T>
+FastArrayStack<T>& FastArrayStack<T>::operator=(FastArrayStack<T> &&b){
+	if (this != &b){
+		a = std::move(b.a);
+		n = b.n;
+		policy = b.policy;
+		b.n = 0;
+	}
+	return *this;
+}
+
 template <class T>
-void FastArrayStack<T>::resize(){
-	Array<T> b(std::max(2*n, 1));
-	std::copy(&a[0], &a[0]+n, &b[0]);	// Need to work with pointers here
-	a = b;
+void FastArrayStack<T>::resize(int length){
+	Array<T> b(length);
+	std::move(&a[0], &a[0]+n, &b[0]);	// Need to work with pointers here
+	a = std::move(b);
+	this->resized(n);
 }
 
 
@@ -20,36 +46,36 @@ int FastArrayStack<T>::size(){
 
 
 template <class T>
-T FastArrayStack<T>::get(int i){
+const T& FastArrayStack<T>::get(int i){
 	return a[i];
 }
 
 
 template <class T>
 T FastArrayStack<T>::set(int i, T x){
-	T y = a[i];
-	a[i] = x;
+	T y = std::move(a[i]);
+	a[i] = std::move(x);
 	return y;
 }
 
 
 template <class T>
 void FastArrayStack<T>::add(int i, T x){
-	if (n+1 > a.length()) resize();
-	std::copy_backward(&a[i], &a[0]+n, &a[0]+(n+1));
-	a[i] = x;
+	if (n+1 > a.length()) resize(std::max(2*n, 1));
+	this->shifted(n - i);
+	std::move_backward(&a[i], &a[0]+n, &a[0]+(n+1));
+	a[i] = std::move(x);
 	n++;
 }
 
 
 template <class T>
 T FastArrayStack<T>::remove(int i){
-	T x = a[i];
-	for (int j = i; j < n-1; j++){
-		a[j] = a[j+1];
-	}
+	T x = std::move(a[i]);
+	this->shifted(n - i - 1);
+	std::move(&a[0]+i+1, &a[0]+n, &a[0]+i);
 	n--;
-	if (a.length() >= 3*n) resize();
+	if (policy.shrinks(a.length(), n)) resize(policy.shrunkLength(n));
 
 	return x;
 }
@@ -61,7 +87,7 @@ T FastArrayStack<T>::remove(int i){
 */
 template <class T>
 void FastArrayStack<T>::push(T x){
-	add(n, x);
+	add(n, std::move(x));
 }
 
 template <class T>
@@ -70,3 +96,117 @@ T FastArrayStack<T>::pop(){
 }
 
 
+template <class T>
+int FastArrayStack<T>::capacity(){
+	return a.length();
+}
+
+template <class T>
+void FastArrayStack<T>::reserve(int m){
+	if (m > a.length()) resize(m);
+}
+
+template <class T>
+void FastArrayStack<T>::shrinkToFit(){
+	if (a.length() > std::max(n, 1)) resize(std::max(n, 1));
+}
+
+template <class T>
+ShrinkPolicy FastArrayStack<T>::shrinkPolicy(){
+	return policy;
+}
+
+template <class T>
+void FastArrayStack<T>::setShrinkPolicy(ShrinkPolicy p){
+	policy = p;
+}
+
+/**
+* Sorts the backing array directly, eg
+*   as.sort(mergeSort<int>);
+* See ds/sorting.h for the available algorithms.
+*/
+template <class T>
+template <class Sort>
+void FastArrayStack<T>::sort(Sort sortRange){
+	sortRange(&a[0], n);
+}
+
+
+template <class T>
+int FastArrayStack<T>::indexOf(const T& x){
+	return scanIndexOf(&a[0], n, x);
+}
+
+template <class T>
+bool FastArrayStack<T>::contains(const T& x){
+	return indexOf(x) >= 0;
+}
+
+template <class T>
+int FastArrayStack<T>::count(const T& x){
+	return scanCount(&a[0], n, x);
+}
+
+template <class T>
+T FastArrayStack<T>::min(){
+	if (n == 0){
+		throw std::out_of_range("list is empty");
+	}
+	return scanMin(&a[0], n);
+}
+
+template <class T>
+T FastArrayStack<T>::max(){
+	if (n == 0){
+		throw std::out_of_range("list is empty");
+	}
+	return scanMax(&a[0], n);
+}
+
+template <class T>
+typename ScanSum<T>::type FastArrayStack<T>::sum(){
+	return scanSum(&a[0], n);
+}
+
+
+template <class T>
+template <class F>
+void FastArrayStack<T>::forEach(F f){
+	parallelForEach(&a[0], n, f);
+}
+
+template <class T>
+template <class F>
+void FastArrayStack<T>::transform(F f){
+	parallelTransform(&a[0], n, f);
+}
+
+template <class T>
+template <class S, class Op>
+S FastArrayStack<T>::reduce(S init, Op op){
+	return parallelReduce(&a[0], n, init, op);
+}
+
+template <class T>
+template <class Op>
+void FastArrayStack<T>::inclusiveScan(Op op){
+	parallelInclusiveScan(&a[0], n, op);
+}
+
+
+template <class T>
+OpStats FastArrayStack<T>::stats(){
+	return this->counts();
+}
+
+
+template <class T>
+long FastArrayStack<T>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T>
+long FastArrayStack<T>::bytesReserved(){
+	return (long)a.length() * sizeof(T);
+}
@@ -0,0 +1,91 @@
+/**
+* In-order iteration without a stack.
+*
+* Because every node knows its parent, the next node in sorted order
+* can always be found from the current one:
+*   - if u has a right subtree, it is the smallest node in that subtree
+*   - otherwise, climb until we arrive at a parent from its left child
+*
+*          8
+*        /   \
+*       3     10
+*        \      \
+*         4      12
+*
+* next(4): 4 has no right subtree. Climb to 3 (arrived from the right),
+* then to 8 (arrived from the left), so 8 is next.
+*
+* Each edge is crossed at most twice in a complete traversal, so
+* iterating over all n keys costs O(n), and a single step is O(1)
+* amortized.
+*/
+
+#include "ds/binary_trees.h"
+
+
+template <class T>
+BTNode<T>* BTIterator<T>::next(BTNode<T>* u){
+	if (u->right != nullptr){
+		u = u->right;
+		while (u->left != nullptr){
+			u = u->left;
+		}
+		return u;
+	}
+	while (u->parent != nullptr && u->parent->right == u){
+		u = u->parent;
+	}
+	return u->parent;
+}
+
+template <class T>
+BTNode<T>* BTIterator<T>::prev(BTNode<T>* u){
+	if (u->left != nullptr){
+		u = u->left;
+		while (u->right != nullptr){
+			u = u->right;
+		}
+		return u;
+	}
+	while (u->parent != nullptr && u->parent->left == u){
+		u = u->parent;
+	}
+	return u->parent;
+}
+
+
+template <class T>
+BTIterator<T>& BTIterator<T>::operator++(){
+	u = next(u);
+	return *this;
+}
+
+template <class T>
+BTIterator<T> BTIterator<T>::operator++(int){
+	BTIterator<T> old = *this;
+	u = next(u);
+	return old;
+}
+
+/**
+* Stepping back from end() gives the largest key in the tree.
+*/
+template <class T>
+BTIterator<T>& BTIterator<T>::operator--(){
+	if (u == nullptr){
+		u = *root;
+		while (u->right != nullptr){
+			u = u->right;
+		}
+	} else {
+		u = prev(u);
+	}
+	return *this;
+}
+
+template <class T>
+BTIterator<T> BTIterator<T>::operator--(int){
+	BTIterator<T> old = *this;
+	--(*this);
+	return old;
+}
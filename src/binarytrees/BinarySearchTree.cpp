@@ -26,6 +26,7 @@
 * order and there are no further deletions or additions to the tree
 */
 
+#include <iostream>
 #include <stdexcept>
 #include "ds/array_lists.h"
 #include "ds/binary_trees.h"
@@ -50,6 +51,9 @@ int BinarySearchTree<T>::size(){
 	ArrayQueue<BTNode<T>*> queue;
 	int counter = 0;
 
+	if (root == nullptr){
+		return 0;
+	}
 	queue.enqueue(root);
 
 	while (queue.size()){
@@ -68,57 +72,72 @@ int BinarySearchTree<T>::size(){
 }
 
 /**
-* If we don't have a root node, add this as the root node
-* If we do have a root node and x is smaller than root, look left
-*   if it's bigger, look right
-* Keep doing that until we find a node with no children
-* Add x to the left or right of that node as appropriate
-* If we encounter a node containing x at any point, abort and return false
+* Nodes are released by walking the tree with the parent pointers,
+* deleting each leaf and then detaching it from its parent. This avoids
+* both recursion and an auxiliary queue.
+*
+* Subclasses with their own node type call deleteTree from their
+* destructor, so each node is deleted as the type it was allocated as.
 */
 template <class T>
-bool BinarySearchTree<T>::add(T x){
+BinarySearchTree<T>::~BinarySearchTree(){
+	deleteTree<BTNode<T> >();
+}
+
+template <class T>
+template <class Node>
+void BinarySearchTree<T>::deleteTree(){
+	BTNode<T>* u = root;
+	while (u != nullptr){
+		if (u->left != nullptr){
+			u = u->left;
+		} else if (u->right != nullptr){
+			u = u->right;
+		} else {
+			BTNode<T>* parent = u->parent;
+			if (parent != nullptr){
+				if (parent->left == u){
+					parent->left = nullptr;
+				} else {
+					parent->right = nullptr;
+				}
+			}
+			delete static_cast<Node*>(u);
+			u = parent;
+		}
+	}
+	root = nullptr;
+}
+
+/**
+* Search for x, returning the node containing it or, if x is not in the
+* tree, the node that would become its parent. Returns nullptr for an
+* empty tree.
+*/
+template <class T>
+BTNode<T>* BinarySearchTree<T>::findLast(const T& x){
 	BTNode<T>* previousNode = nullptr;
 	BTNode<T>* currentNode = root;
 
-	// Search for x in the tree
 	while (currentNode != nullptr) {
-		if (x == currentNode->x){
-			return false;	// We found x, don't need to do anything else
-		} else if (x < currentNode->x) {
-			// Go down the left branch
-			previousNode = currentNode;
+		previousNode = currentNode;
+		if (x < currentNode->x) {
 			currentNode = currentNode->left;
 		} else if (x > currentNode->x) {
-			// Go down the right branch
-			previousNode = currentNode;
 			currentNode = currentNode->right;
+		} else {
+			return currentNode;
 		}
 	}
-
-	// If we got here, we did not find x,
-	// We can add it in as a leaf of previousNode
-
-	// Special case if this is the first entry
-	BTNode<T>* xNode = new BTNode<T>(x);
-	xNode->parent = previousNode;
-
-	if (previousNode == nullptr){
-		root = xNode;
-	} else if (x < previousNode->x){
-		previousNode->left = xNode;
-	}
-	else if (x > previousNode->x){
-		previousNode->right = xNode;
-	}
-
-
-	return true;
+	return previousNode;
 }
 
-
+/**
+* Search for the node containing exactly x.
+* Throws std::out_of_range if there isn't one.
+*/
 template <class T>
-T BinarySearchTree<T>::remove(T x){
-	// First, find the node.
+BTNode<T>* BinarySearchTree<T>::findNode(const T& x){
 	BTNode<T>* currentNode = root;
 
 	while (currentNode != nullptr){
@@ -131,10 +150,57 @@ T BinarySearchTree<T>::remove(T x){
 		}
 	}
 
-	//Throw an exception if it's not found
 	if (currentNode == nullptr){
 		throw std::out_of_range("Could not find x for removal");
 	}
+	return currentNode;
+}
+
+/**
+* Attach the new node u as a child of parent, as returned by findLast.
+* Returns false without modifying the tree if parent already holds u->x.
+*/
+template <class T>
+bool BinarySearchTree<T>::addChild(BTNode<T>* parent, BTNode<T>* u){
+	// Special case if this is the first entry
+	if (parent == nullptr){
+		root = u;
+	} else if (u->x < parent->x){
+		parent->left = u;
+	} else if (u->x > parent->x){
+		parent->right = u;
+	} else {
+		return false;
+	}
+	u->parent = parent;
+	return true;
+}
+
+/**
+* If we don't have a root node, add this as the root node
+* If we do have a root node and x is smaller than root, look left
+*   if it's bigger, look right
+* Keep doing that until we find a node with no children
+* Add x to the left or right of that node as appropriate
+* If we encounter a node containing x at any point, abort and return false
+*/
+template <class T>
+bool BinarySearchTree<T>::add(T x){
+	BTNode<T>* previousNode = findLast(x);
+	if (previousNode != nullptr && previousNode->x == x){
+		return false;	// We found x, don't need to do anything else
+	}
+
+	// If we got here, we did not find x,
+	// We can add it in as a leaf of previousNode
+	return addChild(previousNode, new BTNode<T>(std::move(x)));
+}
+
+
+template <class T>
+T BinarySearchTree<T>::remove(T x){
+	// First, find the node. Throws an exception if it's not found
+	BTNode<T>* currentNode = findNode(x);
 
 	// If it has one child, make that child the new left/right of parent as appropriate
 	// If it has no children do the same, it will just be noops with nullptrs
@@ -145,7 +211,7 @@ T BinarySearchTree<T>::remove(T x){
 	} else {
 		BTNode<T>* smallestToRight = smallestNodeInSubtree(currentNode->right);
 		// To avoid moving lots of nodes around, just move the data and delete the smallest by splice
-		currentNode->x = smallestToRight->x;
+		currentNode->x = std::move(smallestToRight->x);
 		// Now we can just remove the smallestToRightNode
 		splice(smallestToRight);
 		delete smallestToRight;	// Probably need a destructor here to remove reference to parent
@@ -166,7 +232,7 @@ T BinarySearchTree<T>::remove(T x){
 * if there's only one node in the tree
 */
 template <class T>
-T BinarySearchTree<T>::find(T x){
+T BinarySearchTree<T>::find(const T& x){
 	BTNode<T>* previousBigNode = nullptr;
 	BTNode<T>* currentNode = root;
 
@@ -197,6 +263,70 @@ T BinarySearchTree<T>::find(T x){
 	return previousBigNode->x;
 }
 
+template <class T>
+typename BinarySearchTree<T>::iterator BinarySearchTree<T>::begin(){
+	BTNode<T>* u = root;
+	if (u != nullptr){
+		u = smallestNodeInSubtree(u);
+	}
+	return iterator(u, &root);
+}
+
+template <class T>
+typename BinarySearchTree<T>::iterator BinarySearchTree<T>::end(){
+	return iterator(nullptr, &root);
+}
+
+/**
+* Same descent as find(), but returns the position rather than
+* the value, and end() rather than throwing if there is no key >= x.
+*/
+template <class T>
+typename BinarySearchTree<T>::iterator BinarySearchTree<T>::lower_bound(T x){
+	BTNode<T>* previousBigNode = nullptr;
+	BTNode<T>* currentNode = root;
+
+	while (currentNode != nullptr) {
+		if (currentNode->x < x) {
+			currentNode = currentNode->right;
+		} else {
+			previousBigNode = currentNode;
+			currentNode = currentNode->left;
+		}
+	}
+	return iterator(previousBigNode, &root);
+}
+
+template <class T>
+typename BinarySearchTree<T>::iterator BinarySearchTree<T>::upper_bound(T x){
+	BTNode<T>* previousBigNode = nullptr;
+	BTNode<T>* currentNode = root;
+
+	while (currentNode != nullptr) {
+		if (x < currentNode->x) {
+			previousBigNode = currentNode;
+			currentNode = currentNode->left;
+		} else {
+			currentNode = currentNode->right;
+		}
+	}
+	return iterator(previousBigNode, &root);
+}
+
+/**
+* Two descents find the ends of the range. Scanning the range then
+* costs O(k) for k keys, with no further searching.
+*
+*   for (int x : tree.range(a, b)) ...
+*/
+template <class T>
+BTRange<T> BinarySearchTree<T>::range(T a, T b){
+	if (!(a < b)){
+		return BTRange<T>(end(), end());
+	}
+	return BTRange<T>(lower_bound(a), lower_bound(b));
+}
+
 template <class T>
 void BinarySearchTree<T>::splice(BTNode<T>* removalNode){
 	BTNode<T>* spliced;
@@ -224,6 +354,103 @@ void BinarySearchTree<T>::splice(BTNode<T>* removalNode){
 	}
 }
 
+/**
+* Start state:
+*
+*        {8,5}
+*		/     \
+*    {4,6}  {12,4}
+*           /     \
+*        {9,7}   {15,8}
+*
+* rotateLeft({8,5}):
+*
+*        {12,4}
+*       /      \
+*    {8,5}   {15,8}
+*	/     \
+* {4,6}  {9,7}
+*
+* Rotations preserve the binary search tree property, so the
+* balanced subclasses use them to restore their own invariants
+* (the heap property for the Treap, colours for the RedBlackTree).
+*/
+template <class T>
+void BinarySearchTree<T>::rotateLeft(BTNode<T>* u){
+	BTNode<T>* w = u->right;
+	w->parent = u->parent;
+	if (w->parent != nullptr){
+		if (w->parent->left == u) {
+			w->parent->left = w;
+		} else {
+			w->parent->right = w;
+		}
+	}
+	u->right = w->left;
+	if (u->right != nullptr){
+		u->right->parent = u;
+	}
+	u->parent = w;
+	w->left = u;
+	if (u == root){
+		root = w;
+		root->parent = nullptr;
+	}
+}
+
+/**
+* Start state:
+*
+*        {12,4}
+*       /      \
+*    {8,1}   {15,8}
+*	/     \
+* {4,2}  {9,6}
+*
+* rotateRight({12,4}):
+*
+*        {8,1}
+*		/     \
+*    {4,2}  {12,4}
+*           /     \
+*        {9,6}   {15,8}
+*
+*/
+template <class T>
+void BinarySearchTree<T>::rotateRight(BTNode<T>* u){
+	BTNode<T>* w = u->left;
+	w->parent = u->parent;
+	if (w->parent != nullptr){
+		if (w->parent->left == u) {
+			w->parent->left = w;
+		} else {
+			w->parent->right = w;
+		}
+	}
+	u->left = w->right;
+	if (u->left != nullptr){
+		u->left->parent = u;
+	}
+	u->parent = w;
+	w->right = u;
+	if (u == root){
+		root=w;
+		root->parent = nullptr;
+	}
+}
+
+/**
+* Number of nodes in the subtree rooted at u.
+* Recursion depth is bounded by the height of the subtree.
+*/
+template <class T>
+int BinarySearchTree<T>::subtreeSize(BTNode<T>* u){
+	if (u == nullptr){
+		return 0;
+	}
+	return 1 + subtreeSize(u->left) + subtreeSize(u->right);
+}
+
 template <class T>
 BTNode<T>* BinarySearchTree<T>::smallestNodeInSubtree(BTNode<T>* startNode){
 	BTNode<T>* previousNode = nullptr;
@@ -333,3 +560,23 @@ void BinarySearchTree<T>::draw(){
 		spacing = spacing / 2;
 	}
 }
+
+
+template <class T>
+long BinarySearchTree<T>::nodeBytes(){
+	return sizeof(BTNode<T>);
+}
+
+/**
+* Each value has a node of its own. Takes O(n) time here, since size()
+* counts the nodes, but the subclasses keep a count.
+*/
+template <class T>
+long BinarySearchTree<T>::bytesUsed(){
+	return (long)this->size() * sizeof(T);
+}
+
+template <class T>
+long BinarySearchTree<T>::bytesReserved(){
+	return (long)this->size() * nodeBytes();
+}
@@ -0,0 +1,296 @@
+/**
+* Sequence stored in a Treap, with positions as implicit keys.
+*
+* The nodes are in list order from left to right, and each node keeps
+* the size of its subtree. The position of a node is never stored,
+* since it changes whenever something is added in front of it, but
+* get(i) can find position i from the sizes: if the left subtree has
+* i nodes, the root is at position i; if it has more, look for i in
+* the left subtree; otherwise look for i - size(left) - 1 on the right.
+*
+* Priorities are random and heap ordered exactly as in the Treap, so
+* the tree has O(log(n)) expected depth whatever order the elements
+* arrive in. Every update is built from the split and join of
+* TreapSetAlgebra.cpp, with a position taking the place of the value:
+*
+*   split(u, i) = (first i elements, the rest)
+*   add(i, x)   = join(join(l, x), r)       where (l, r) = split(root, i)
+*   remove(i)   = join(l, r')               where (x, r') = split(r, 1)
+*
+* Reversing [i, j) splits out the range and sets a flag on its root.
+* The flag means "mirror this subtree", and is only pushed down (by
+* swapping the node's children and flagging them instead) when split
+* or join needs to look below the node, so a reversal costs O(log(n))
+* however long the range is:
+*
+*        b*               b            * reversed
+*       / \     push     / \
+*      a   c    ---->   c*  a*     reads c b a in order
+*
+* get and set never write to the flags. They track whether an odd
+* number of flags lie above the node instead, and if so swap left and
+* right as they descend.
+*
+* Parent pointers are kept up to date but not needed by anything here.
+*
+* Performance:
+*
+* 				Worst case		Expected
+*        get(i):   O(n)         O(log(n))
+*      set(i,x):   O(n)         O(log(n))
+*      add(i,x):   O(n)         O(log(n))
+*     remove(i):   O(n)         O(log(n))
+*     concat(b):   O(n)         O(log(n))
+*  splitAt(i,b):   O(n)         O(log(n)), plus the size of b's old contents to delete them
+*  reverse(i,j):   O(n)         O(log(n))
+*/
+
+#include <stdexcept>
+#include <stdlib.h>
+#include <utility>
+
+#include "ds/binary_trees.h"
+
+
+template <class T>
+ImplicitTreap<T>::~ImplicitTreap(){
+	deleteNodes(root);
+}
+
+template <class T>
+int ImplicitTreap<T>::size(Node* u){
+	return (u == nullptr) ? 0 : u->size;
+}
+
+template <class T>
+ImplicitTreapNode<T>* ImplicitTreap<T>::child(BTNode<T>* u){
+	return static_cast<Node*>(u);
+}
+
+/**
+* Recompute u's size after its children have changed.
+*/
+template <class T>
+void ImplicitTreap<T>::update(Node* u){
+	u->size = 1 + size(child(u->left)) + size(child(u->right));
+	if (u->left != nullptr){
+		u->left->parent = u;
+	}
+	if (u->right != nullptr){
+		u->right->parent = u;
+	}
+}
+
+template <class T>
+void ImplicitTreap<T>::pushDown(Node* u){
+	if (u->reversed){
+		std::swap(u->left, u->right);
+		if (u->left != nullptr){
+			child(u->left)->reversed ^= true;
+		}
+		if (u->right != nullptr){
+			child(u->right)->reversed ^= true;
+		}
+		u->reversed = false;
+	}
+}
+
+/**
+* l gets the first i elements of u's subtree and r the rest. Parent
+* pointers of l and r are not cleared.
+*/
+template <class T>
+void ImplicitTreap<T>::split(Node* u, int i, Node* &l, Node* &r){
+	if (u == nullptr){
+		l = nullptr;
+		r = nullptr;
+		return;
+	}
+	pushDown(u);
+	int s = size(child(u->left));
+	if (i <= s){
+		Node* ll;
+		split(child(u->left), i, ll, l);
+		u->left = l;
+		update(u);
+		l = ll;
+		r = u;
+	} else {
+		Node* rr;
+		split(child(u->right), i - s - 1, r, rr);
+		u->right = r;
+		update(u);
+		l = u;
+		r = rr;
+	}
+}
+
+/**
+* All of l comes before all of r.
+*/
+template <class T>
+ImplicitTreapNode<T>* ImplicitTreap<T>::join(Node* l, Node* r){
+	if (l == nullptr){
+		return r;
+	}
+	if (r == nullptr){
+		return l;
+	}
+	if (l->p < r->p){
+		pushDown(l);
+		l->right = join(child(l->right), r);
+		update(l);
+		return l;
+	} else {
+		pushDown(r);
+		r->left = join(l, child(r->left));
+		update(r);
+		return r;
+	}
+}
+
+template <class T>
+void ImplicitTreap<T>::deleteNodes(Node* u){
+	if (u != nullptr){
+		deleteNodes(child(u->left));
+		deleteNodes(child(u->right));
+		delete u;
+	}
+}
+
+template <class T>
+void ImplicitTreap<T>::checkIndex(int i, int n){
+	if (i < 0 || i >= n){
+		throw std::out_of_range("index is outside the list");
+	}
+}
+
+template <class T>
+ImplicitTreapNode<T>* ImplicitTreap<T>::getNode(int i){
+	checkIndex(i, size());
+	Node* u = root;
+	bool flipped = false;
+	while (true){
+		flipped ^= u->reversed;
+		Node* l = child(flipped ? u->right : u->left);
+		Node* r = child(flipped ? u->left : u->right);
+		int s = size(l);
+		if (i < s){
+			u = l;
+		} else if (i == s){
+			return u;
+		} else {
+			i -= s + 1;
+			u = r;
+		}
+	}
+}
+
+
+template <class T>
+int ImplicitTreap<T>::size(){
+	return size(root);
+}
+
+template <class T>
+const T& ImplicitTreap<T>::get(int i){
+	return getNode(i)->x;
+}
+
+template <class T>
+T ImplicitTreap<T>::set(int i, T x){
+	Node* u = getNode(i);
+	T old = std::move(u->x);
+	u->x = std::move(x);
+	return old;
+}
+
+template <class T>
+void ImplicitTreap<T>::add(int i, T x){
+	checkIndex(i, size() + 1);
+	Node* l;
+	Node* r;
+	split(root, i, l, r);
+	root = join(join(l, new Node(std::move(x), rand())), r);
+	root->parent = nullptr;
+}
+
+template <class T>
+T ImplicitTreap<T>::remove(int i){
+	checkIndex(i, size());
+	Node* l;
+	Node* m;
+	Node* r;
+	split(root, i, l, r);
+	split(r, 1, m, r);
+	T x = std::move(m->x);
+	delete m;
+	root = join(l, r);
+	if (root != nullptr){
+		root->parent = nullptr;
+	}
+	return x;
+}
+
+
+template <class T>
+void ImplicitTreap<T>::concat(ImplicitTreap<T> &b){
+	if (&b == this){
+		return;
+	}
+	root = join(root, b.root);
+	if (root != nullptr){
+		root->parent = nullptr;
+	}
+	b.root = nullptr;
+}
+
+template <class T>
+void ImplicitTreap<T>::splitAt(int i, ImplicitTreap<T> &b){
+	if (&b == this){
+		return;
+	}
+	checkIndex(i, size() + 1);
+	deleteNodes(b.root);
+	Node* l;
+	Node* r;
+	split(root, i, l, r);
+	if (l != nullptr){
+		l->parent = nullptr;
+	}
+	if (r != nullptr){
+		r->parent = nullptr;
+	}
+	b.root = l;
+	root = r;
+}
+
+template <class T>
+void ImplicitTreap<T>::reverse(int i, int j){
+	if (i < 0 || j > size() || i > j){
+		throw std::out_of_range("range is outside the list");
+	}
+	Node* l;
+	Node* m;
+	Node* r;
+	split(root, i, l, r);
+	split(r, j - i, m, r);
+	if (m != nullptr){
+		m->reversed ^= true;
+	}
+	root = join(join(l, m), r);
+	if (root != nullptr){
+		root->parent = nullptr;
+	}
+}
+
+
+template <class T>
+long ImplicitTreap<T>::bytesUsed(){
+	return (long)size() * sizeof(T);
+}
+
+template <class T>
+long ImplicitTreap<T>::bytesReserved(){
+	return (long)size() * sizeof(Node);
+}
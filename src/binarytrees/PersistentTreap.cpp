@@ -0,0 +1,253 @@
+/**
+* Persistent (path copying) Treap.
+*
+* The tree is ordered and heap ordered exactly as the Treap, but nodes
+* are never modified once they are part of a tree. Instead, add(x) and
+* remove(x) copy the nodes on the path from the root to x and reuse
+* every other subtree:
+*
+*        {8,1}                         {8,1}'
+*       /     \                       /     \
+*    {4,6}   {12,3}      add(10)   {4,6}   {12,3}'
+*            /    \       --->             /    \
+*         {9,7}  {15,8}                {9,7}'  {15,8}
+*                                          \
+*                                        {10,9}
+*
+* The primed nodes are new copies. {4,6} and {15,8} are shared by both
+* versions, while the old version keeps its own {8,1}, {12,3} and {9,7}.
+*
+* The old root still describes the old tree, so a snapshot is just
+* another reference to the current root. Rotations only ever involve
+* freshly copied nodes, so they can't affect older versions.
+*
+* Nodes are reference counted, counting both parent nodes and trees.
+* When the last version that can reach a node is destroyed, the node
+* is freed. The counts are atomic, so a snapshot can be handed to
+* another thread and read or destroyed there without locks. The tree
+* being written to is not itself thread-safe; readers should take a
+* snapshot rather than sharing it.
+*
+* Performance:
+*
+* 				Expected
+*      add(x):     O(log(n)) time, O(log(n)) new nodes
+*   remove(x):     O(log(n)) time, O(log(n)) new nodes
+*     find(x):     O(log(n))
+*  snapshot():     O(1)
+*/
+
+#include <stdlib.h>
+#include <stdexcept>
+#include <utility>
+
+#include "ds/binary_trees.h"
+
+
+template <class T>
+PersistentTreapNode<T>* PersistentTreap<T>::retain(Node* u){
+	if (u != nullptr){
+		u->refs.fetch_add(1);
+	}
+	return u;
+}
+
+/**
+* Drop one reference to u. If it was the last, free u and
+* drop its references to its children.
+*/
+template <class T>
+void PersistentTreap<T>::release(Node* u){
+	while (u != nullptr && u->refs.fetch_sub(1) == 1){
+		release(u->left);
+		Node* right = u->right;
+		delete u;
+		u = right;	// Loop rather than recurse down the right branch
+	}
+}
+
+template <class T>
+PersistentTreap<T>& PersistentTreap<T>::operator=(const PersistentTreap<T> &b){
+	Node* old = root;
+	root = retain(b.root);
+	n = b.n;
+	release(old);
+	return *this;
+}
+
+template <class T>
+PersistentTreap<T>::~PersistentTreap(){
+	release(root);
+}
+
+
+template <class T>
+int PersistentTreap<T>::size(){
+	return n;
+}
+
+template <class T>
+PersistentTreap<T> PersistentTreap<T>::snapshot(){
+	return PersistentTreap<T>(root, n);
+}
+
+template <class T>
+PersistentTreapNode<T>* PersistentTreap<T>::findNode(const T& x){
+	Node* u = root;
+	while (u != nullptr){
+		if (x < u->x){
+			u = u->left;
+		} else if (u->x < x){
+			u = u->right;
+		} else {
+			return u;
+		}
+	}
+	return nullptr;
+}
+
+template <class T>
+T PersistentTreap<T>::find(const T& x){
+	Node* previousBigNode = nullptr;
+	Node* u = root;
+	while (u != nullptr){
+		if (x < u->x){
+			previousBigNode = u;
+			u = u->left;
+		} else if (u->x < x){
+			u = u->right;
+		} else {
+			return u->x;
+		}
+	}
+	if (previousBigNode == nullptr){
+		throw std::out_of_range("No values larger than x in tree");
+	}
+	return previousBigNode->x;
+}
+
+
+template <class T>
+bool PersistentTreap<T>::add(T x){
+	if (findNode(x) != nullptr){
+		return false;
+	}
+	Node* old = root;
+	root = insert(root, x, rand());
+	release(old);
+	n++;
+	return true;
+}
+
+/**
+* Returns a new version of the subtree rooted at u with x added.
+* x must not already be in the subtree, and is moved into the new
+* leaf rather than copied at every level. Every node on the returned
+* path is a fresh copy owned by the caller, so the rotation that
+* restores the heap property can modify them in place.
+*/
+template <class T>
+PersistentTreapNode<T>* PersistentTreap<T>::insert(Node* u, T &x, int p){
+	if (u == nullptr){
+		return new Node(std::move(x), p);
+	}
+
+	Node* w = new Node(u->x, u->p);
+	if (x < u->x){
+		Node* l = insert(u->left, x, p);
+		w->left = l;
+		w->right = retain(u->right);
+		if (l->p < w->p){
+			// rotateRight(w)
+			w->left = l->right;
+			l->right = w;
+			return l;
+		}
+	} else {
+		Node* r = insert(u->right, x, p);
+		w->left = retain(u->left);
+		w->right = r;
+		if (r->p < w->p){
+			// rotateLeft(w)
+			w->right = r->left;
+			r->left = w;
+			return r;
+		}
+	}
+	return w;
+}
+
+
+template <class T>
+T PersistentTreap<T>::remove(T x){
+	if (findNode(x) == nullptr){
+		throw std::out_of_range("Could not find x for removal");
+	}
+	Node* old = root;
+	root = erase(root, x);
+	release(old);
+	n--;
+	return x;
+}
+
+/**
+* Returns a new version of the subtree rooted at u without x,
+* which must be in the subtree.
+*/
+template <class T>
+PersistentTreapNode<T>* PersistentTreap<T>::erase(Node* u, const T& x){
+	if (x < u->x){
+		Node* w = new Node(u->x, u->p);
+		w->left = erase(u->left, x);
+		w->right = retain(u->right);
+		return w;
+	} else if (u->x < x){
+		Node* w = new Node(u->x, u->p);
+		w->left = retain(u->left);
+		w->right = erase(u->right, x);
+		return w;
+	}
+	return merge(u->left, u->right);
+}
+
+/**
+* Join two subtrees, where every value in a is smaller than every
+* value in b. This is the persistent version of rotating the removed
+* node down to a leaf: the child with the lower priority is copied
+* and becomes the root.
+*/
+template <class T>
+PersistentTreapNode<T>* PersistentTreap<T>::merge(Node* a, Node* b){
+	if (a == nullptr){
+		return retain(b);
+	}
+	if (b == nullptr){
+		return retain(a);
+	}
+	if (a->p < b->p){
+		Node* w = new Node(a->x, a->p);
+		w->left = retain(a->left);
+		w->right = merge(a->right, b);
+		return w;
+	} else {
+		Node* w = new Node(b->x, b->p);
+		w->left = merge(a, b->left);
+		w->right = retain(b->right);
+		return w;
+	}
+}
+
+
+/**
+* Counts every node of this version, including those shared with
+* other versions, so the total over several versions is an upper bound.
+*/
+template <class T>
+long PersistentTreap<T>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T>
+long PersistentTreap<T>::bytesReserved(){
+	return (long)n * sizeof(Node);
+}
@@ -0,0 +1,333 @@
+/**
+* Balanced binary tree with worst case guarantees.
+*
+* Every node is coloured red or black, and the tree maintains:
+*   - the black-height property: every root to leaf path
+*     contains the same number of black nodes
+*   - the no-red-edge property: a red node never has a red child
+*   - the left-leaning property: if a node's left child is black,
+*     so is its right child
+*
+* Together these mean the tree is a 2-4 tree in disguise (a black node
+* and its red children form one 2-4 tree node), so the height of the
+* tree is never more than 2log(n).
+*
+* Missing children (nullptr) count as black. During removal a node can
+* temporarily be double black; if the node in question is a missing
+* child, the tree's nil node is hung in its place until the colours
+* have been fixed up.
+*
+* Unlike the Treap, no random numbers are involved, so sorted input
+* (eg time ordered keys) can't produce a badly balanced tree.
+*
+* Performance:
+*
+* 				Worst case
+*      add(x):     O(log(n))
+*   remove(x):     O(log(n))
+*     find(x):     O(log(n))
+*/
+
+#include <stdexcept>
+
+#include "ds/binary_trees.h"
+
+
+template <class T>
+char RedBlackTree<T>::colour(BTNode<T>* u){
+	if (u == nullptr){
+		return black;
+	}
+	return static_cast<RedBlackNode<T>*>(u)->colour;
+}
+
+template <class T>
+void RedBlackTree<T>::setColour(BTNode<T>* u, char c){
+	if (u != nullptr){
+		static_cast<RedBlackNode<T>*>(u)->colour = c;
+	}
+}
+
+/**
+* Move the blackness of u down to its two (red) children.
+*/
+template <class T>
+void RedBlackTree<T>::pushBlack(BTNode<T>* u){
+	setColour(u, colour(u) - 1);
+	setColour(u->left, colour(u->left) + 1);
+	setColour(u->right, colour(u->right) + 1);
+}
+
+/**
+* Move blackness from the two children of u up to u.
+*/
+template <class T>
+void RedBlackTree<T>::pullBlack(BTNode<T>* u){
+	setColour(u, colour(u) + 1);
+	setColour(u->left, colour(u->left) - 1);
+	setColour(u->right, colour(u->right) - 1);
+}
+
+/**
+* Swap the colours of u and its right child, then rotate left.
+* The black-height of the subtree is unchanged.
+*/
+template <class T>
+void RedBlackTree<T>::flipLeft(BTNode<T>* u){
+	char c = colour(u);
+	setColour(u, colour(u->right));
+	setColour(u->right, c);
+	this->rotateLeft(u);
+}
+
+template <class T>
+void RedBlackTree<T>::flipRight(BTNode<T>* u){
+	char c = colour(u);
+	setColour(u, colour(u->left));
+	setColour(u->left, c);
+	this->rotateRight(u);
+}
+
+
+template <class T>
+RedBlackTree<T>::~RedBlackTree(){
+	this->template deleteTree<RedBlackNode<T> >();
+}
+
+template <class T>
+int RedBlackTree<T>::size(){
+	return n;
+}
+
+/**
+* The new node is added as a red leaf, which keeps the black-height
+* property but may break the left-leaning or no-red-edge properties.
+*/
+template <class T>
+bool RedBlackTree<T>::add(T x){
+	BTNode<T>* previousNode = this->findLast(x);
+	if (previousNode != nullptr && previousNode->x == x){
+		return false;
+	}
+
+	RedBlackNode<T>* u = new RedBlackNode<T>(std::move(x));
+	this->addChild(previousNode, u);
+	addFixup(u);
+	n++;
+	return true;
+}
+
+/**
+* u is red. Walk up the tree until there is no red-red edge
+* and every node is left-leaning.
+*/
+template <class T>
+void RedBlackTree<T>::addFixup(BTNode<T>* u){
+	while (colour(u) == red){
+		if (u == this->root){
+			// The root is always black
+			setColour(u, black);
+			return;
+		}
+		BTNode<T>* w = u->parent;
+		if (colour(w->left) == black){
+			// u is a right child with a black sibling, make it lean left
+			flipLeft(w);
+			u = w;
+			w = u->parent;
+		}
+		if (colour(w) == black){
+			return;	// No red-red edge
+		}
+		BTNode<T>* g = w->parent;	// w is red so it isn't the root
+		if (colour(g->right) == black){
+			flipRight(g);
+			return;
+		} else {
+			// g has two red children, push its blackness down and continue upwards
+			pushBlack(g);
+			u = g;
+		}
+	}
+}
+
+/**
+* The node w that is spliced out is either the node holding x or the
+* smallest node in its right subtree. Its blackness is passed on to
+* its only child u, which may become double black.
+*/
+template <class T>
+T RedBlackTree<T>::remove(T x){
+	BTNode<T>* u = this->findNode(x);	// Throws if x is not in the tree
+	BTNode<T>* w = u->right;
+	if (w == nullptr){
+		w = u;
+		u = w->left;
+	} else {
+		w = this->smallestNodeInSubtree(w);
+		u->x = std::move(w->x);
+		u = w->right;
+	}
+
+	char c = colour(w);
+	BTNode<T>* parent = w->parent;
+	bool leftChild = parent != nullptr && parent->left == w;
+	this->splice(w);
+	delete static_cast<RedBlackNode<T>*>(w);
+	n--;
+
+	if (u == nullptr){
+		// Hang the nil node where w used to be so it can carry the colour
+		nil.left = nullptr;
+		nil.right = nullptr;
+		nil.colour = black;
+		nil.parent = parent;
+		if (parent == nullptr){
+			this->root = &nil;
+		} else if (leftChild){
+			parent->left = &nil;
+		} else {
+			parent->right = &nil;
+		}
+		u = &nil;
+	}
+	setColour(u, colour(u) + c);
+	removeFixup(u);
+
+	// The fixup may have rotated nil, but it is still a leaf
+	if (nil.parent == nullptr && this->root == &nil){
+		this->root = nullptr;
+	} else if (nil.parent != nullptr && nil.parent->left == &nil){
+		nil.parent->left = nullptr;
+	} else if (nil.parent != nullptr && nil.parent->right == &nil){
+		nil.parent->right = nullptr;
+	}
+	nil.parent = nullptr;
+
+	return x;
+}
+
+template <class T>
+void RedBlackTree<T>::removeFixup(BTNode<T>* u){
+	while (colour(u) > black){
+		if (u == this->root){
+			setColour(u, black);
+		} else if (colour(u->parent->left) == red){
+			u = removeFixupCase1(u);
+		} else if (u == u->parent->left){
+			u = removeFixupCase2(u);
+		} else {
+			u = removeFixupCase3(u);
+		}
+	}
+	if (u != this->root){
+		// Restore the left-leaning property if needed
+		BTNode<T>* w = u->parent;
+		if (colour(w->right) == red && colour(w->left) == black){
+			flipLeft(w);
+		}
+	}
+}
+
+/**
+* u's sibling is red, so u is the right child. Rotate so that
+* u's sibling is black and one of the other two cases applies.
+*/
+template <class T>
+BTNode<T>* RedBlackTree<T>::removeFixupCase1(BTNode<T>* u){
+	flipRight(u->parent);
+	return u;
+}
+
+/**
+* u is the left child and its sibling v is black.
+*/
+template <class T>
+BTNode<T>* RedBlackTree<T>::removeFixupCase2(BTNode<T>* u){
+	BTNode<T>* w = u->parent;
+	BTNode<T>* v = w->right;
+	pullBlack(w);
+	flipLeft(w);	// w is now red
+	BTNode<T>* q = w->right;
+	if (colour(q) == red){
+		// q-w is a red-red edge
+		this->rotateLeft(w);
+		flipRight(v);
+		pushBlack(q);
+		if (colour(v->right) == red){
+			flipLeft(v);
+		}
+		return q;
+	} else {
+		return v;
+	}
+}
+
+/**
+* u is the right child and its sibling v is black.
+*/
+template <class T>
+BTNode<T>* RedBlackTree<T>::removeFixupCase3(BTNode<T>* u){
+	BTNode<T>* w = u->parent;
+	BTNode<T>* v = w->left;
+	pullBlack(w);
+	flipRight(w);	// w is now red
+	BTNode<T>* q = w->left;
+	if (colour(q) == red){
+		// q-w is a red-red edge
+		this->rotateRight(w);
+		flipLeft(v);
+		pushBlack(q);
+		return q;
+	} else {
+		if (colour(v->left) == red){
+			pushBlack(v);
+			return v;
+		} else {
+			flipLeft(v);
+			return w;
+		}
+	}
+}
+
+
+/**
+* Checks each of the red-black properties, throwing std::logic_error
+* if any is broken. Returns the number of black nodes on every
+* root to leaf path.
+*/
+template <class T>
+int RedBlackTree<T>::verify(){
+	if (colour(this->root) != black){
+		throw std::logic_error("root is not black");
+	}
+	return verify(this->root);
+}
+
+template <class T>
+int RedBlackTree<T>::verify(BTNode<T>* u){
+	if (u == nullptr){
+		return colour(u);
+	}
+	if (colour(u) != red && colour(u) != black){
+		throw std::logic_error("node is neither red nor black");
+	}
+	if (colour(u) == red && (colour(u->left) == red || colour(u->right) == red)){
+		throw std::logic_error("red node has a red child");
+	}
+	if (colour(u->right) == red && colour(u->left) == black){
+		throw std::logic_error("node is not left-leaning");
+	}
+	int dl = verify(u->left);
+	int dr = verify(u->right);
+	if (dl != dr){
+		throw std::logic_error("black heights differ");
+	}
+	return dl + colour(u);
+}
+
+
+template <class T>
+long RedBlackTree<T>::nodeBytes(){
+	return sizeof(RedBlackNode<T>);
+}
@@ -0,0 +1,175 @@
+/**
+* Balanced binary tree with amortized guarantees.
+*
+* Nodes carry no extra balancing information. Instead the tree keeps
+* a counter q, an upper bound on the number of nodes, and guarantees
+* that no node is deeper than log_{3/2}(q).
+*
+* When an add() produces a node that is too deep, there must be an
+* ancestor w (the scapegoat) whose child holds more than 2/3 of the
+* nodes in w's subtree. That subtree is rebuilt into a perfectly
+* balanced one. When removals leave q more than twice n, the whole
+* tree is rebuilt.
+*
+* Rebuilding is expensive, but it happens rarely enough that the
+* cost is O(log(n)) amortized per operation. Since nodes are plain
+* BTNodes, this tree uses less memory than the Treap or RedBlackTree.
+*
+* Performance:
+*
+* 				Worst case		Amortized
+*      add(x):     O(n)         O(log(n))
+*   remove(x):     O(n)			O(log(n))
+*     find(x):     O(log(n))	O(log(n))
+*/
+
+#include <cmath>
+#include <utility>
+
+#include "ds/binary_trees.h"
+
+
+template <class T>
+int ScapegoatTree<T>::size(){
+	return n;
+}
+
+/**
+* If the new node ends up deeper than log_{3/2}(q), walk back up
+* until we find the scapegoat and rebuild its subtree.
+*/
+template <class T>
+bool ScapegoatTree<T>::add(T x){
+	BTNode<T>* u = new BTNode<T>(std::move(x));
+	int d = addWithDepth(u);
+	if (d < 0){
+		delete u;
+		return false;
+	}
+	if (d > std::log(q) / std::log(1.5)){
+		// Depth exceeded, find the scapegoat
+		BTNode<T>* w = u->parent;
+		int ws = this->subtreeSize(w);
+		int ps = this->subtreeSize(w->parent);
+		while (3*ws <= 2*ps){
+			w = w->parent;
+			ws = ps;
+			ps = this->subtreeSize(w->parent);
+		}
+		rebuild(w->parent);
+	}
+	return true;
+}
+
+/**
+* Same as BinarySearchTree::add, but returns the depth of the new node,
+* or -1 if x was already present.
+*/
+template <class T>
+int ScapegoatTree<T>::addWithDepth(BTNode<T>* u){
+	BTNode<T>* w = this->root;
+	if (w == nullptr){
+		this->root = u;
+		n++;
+		q++;
+		return 0;
+	}
+
+	int d = 0;
+	while (true){
+		if (u->x < w->x){
+			if (w->left == nullptr){
+				w->left = u;
+				break;
+			}
+			w = w->left;
+		} else if (u->x > w->x){
+			if (w->right == nullptr){
+				w->right = u;
+				break;
+			}
+			w = w->right;
+		} else {
+			return -1;
+		}
+		d++;
+	}
+	u->parent = w;
+	n++;
+	q++;
+	return d + 1;
+}
+
+template <class T>
+T ScapegoatTree<T>::remove(T x){
+	x = BinarySearchTree<T>::remove(std::move(x));	// Throws if x is not in the tree
+	n--;
+	if (2*n < q){
+		rebuild(this->root);
+		q = n;
+	}
+	return x;
+}
+
+
+/**
+* Copy the nodes of u's subtree into an array in sorted order,
+* then link them back together as a perfectly balanced subtree
+* hanging from u's old parent.
+*/
+template <class T>
+void ScapegoatTree<T>::rebuild(BTNode<T>* u){
+	int ns = this->subtreeSize(u);
+	if (ns == 0){
+		return;
+	}
+	BTNode<T>* p = u->parent;
+	Array<BTNode<T>*> a(ns);
+	packIntoArray(u, a, 0);
+
+	if (p == nullptr){
+		this->root = buildBalanced(a, 0, ns);
+		this->root->parent = nullptr;
+	} else if (p->right == u){
+		p->right = buildBalanced(a, 0, ns);
+		p->right->parent = p;
+	} else {
+		p->left = buildBalanced(a, 0, ns);
+		p->left->parent = p;
+	}
+}
+
+/**
+* In-order traversal writing nodes into a starting at i.
+* Returns the next free index.
+*/
+template <class T>
+int ScapegoatTree<T>::packIntoArray(BTNode<T>* u, Array<BTNode<T>*> &a, int i){
+	if (u == nullptr){
+		return i;
+	}
+	i = packIntoArray(u->left, a, i);
+	a[i++] = u;
+	return packIntoArray(u->right, a, i);
+}
+
+/**
+* The middle of a[i..i+ns-1] becomes the root, and each half
+* becomes one of its subtrees.
+*/
+template <class T>
+BTNode<T>* ScapegoatTree<T>::buildBalanced(Array<BTNode<T>*> &a, int i, int ns){
+	if (ns == 0){
+		return nullptr;
+	}
+	int m = ns / 2;
+	a[i+m]->left = buildBalanced(a, i, m);
+	if (a[i+m]->left != nullptr){
+		a[i+m]->left->parent = a[i+m];
+	}
+	a[i+m]->right = buildBalanced(a, i+m+1, ns-m-1);
+	if (a[i+m]->right != nullptr){
+		a[i+m]->right->parent = a[i+m];
+	}
+	return a[i+m];
+}
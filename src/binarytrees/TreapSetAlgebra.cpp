@@ -0,0 +1,310 @@
+/**
+* Join-based set operations on Treaps.
+*
+* Two primitives are enough to combine Treaps without rotations:
+*
+*   split(u, x) separates the subtree u into the values less than x,
+*   the node holding x (if any) and the values greater than x. It only
+*   walks one path, so takes O(log(n)) expected time.
+*
+*   join(l, r) combines two subtrees where every value in l is smaller
+*   than every value in r, by walking down the right spine of l and the
+*   left spine of r in priority order.
+*
+* union(a, b) makes whichever root has the lower priority the root of
+* the result (preserving the heap property), splits the other tree
+* around its value and recurses on the two halves:
+*
+*         a = {8,1}                b = {5,2}
+*            /    \                  /    \
+*          ...    ...             {3,4}   {9,6}
+*
+*   split(b, 8) = ({5,2} with {3,4}, no 8, {9,6})
+*   result = {8,1} with left = union(a.left, {3,4} {5,2}),
+*                       right = union(a.right, {9,6})
+*
+* Intersection and difference follow the same pattern, using join
+* to close the gap where a node is dropped.
+*
+* For sizes m <= n these take O(m log(n/m + 1)) expected time, which
+* is much less than the O(m log(n)) of adding the elements one at a
+* time when m is close to n. The two recursive calls work on disjoint
+* subtrees, so they are forked onto separate threads near the top of
+* the recursion.
+*
+* The nodes of both trees are reused (or deleted) rather than copied,
+* so the argument is left empty.
+*
+* splitAt(x, b) is split exposed directly: the values <= x move to b,
+* which is how YFastTrie divides a bucket in two.
+*/
+
+#include <utility>
+
+#include "ds/binary_trees.h"
+#include "ds/concurrency.h"
+
+
+template <class T>
+int Treap<T>::priority(BTNode<T>* u){
+	return static_cast<TreapNode<T>*>(u)->p;
+}
+
+template <class T>
+void Treap<T>::setChildren(BTNode<T>* u, BTNode<T>* l, BTNode<T>* r){
+	u->left = l;
+	if (l != nullptr){
+		l->parent = u;
+	}
+	u->right = r;
+	if (r != nullptr){
+		r->parent = u;
+	}
+}
+
+/**
+* Every node in a Treap is a TreapNode, so it must be deleted as one.
+*/
+template <class T>
+void Treap<T>::deleteNode(BTNode<T>* u){
+	delete static_cast<TreapNode<T>*>(u);
+}
+
+template <class T>
+void Treap<T>::deleteNodes(BTNode<T>* u){
+	if (u != nullptr){
+		deleteNodes(u->left);
+		deleteNodes(u->right);
+		deleteNode(u);
+	}
+}
+
+/**
+* l gets the values smaller than x, r the values larger than x,
+* and found the node holding x, or nullptr if there isn't one.
+* The parent pointers of l, found and r are not cleared.
+*/
+template <class T>
+void Treap<T>::split(BTNode<T>* u, T x, BTNode<T>* &l, BTNode<T>* &found, BTNode<T>* &r){
+	if (u == nullptr){
+		l = nullptr;
+		found = nullptr;
+		r = nullptr;
+	} else if (x < u->x){
+		BTNode<T>* rl;
+		split(u->left, x, l, found, rl);
+		setChildren(u, rl, u->right);
+		r = u;
+	} else if (u->x < x){
+		BTNode<T>* lr;
+		split(u->right, x, lr, found, r);
+		setChildren(u, u->left, lr);
+		l = u;
+	} else {
+		l = u->left;
+		r = u->right;
+		found = u;
+	}
+}
+
+template <class T>
+BTNode<T>* Treap<T>::join(BTNode<T>* l, BTNode<T>* r){
+	if (l == nullptr){
+		return r;
+	}
+	if (r == nullptr){
+		return l;
+	}
+	if (priority(l) < priority(r)){
+		setChildren(l, l->left, join(l->right, r));
+		return l;
+	} else {
+		setChildren(r, join(l, r->left), r->right);
+		return r;
+	}
+}
+
+/**
+* duplicates counts the values found in both a and b.
+*/
+template <class T>
+BTNode<T>* Treap<T>::unionNodes(BTNode<T>* a, BTNode<T>* b, int depth, int &duplicates){
+	if (a == nullptr){
+		return b;
+	}
+	if (b == nullptr){
+		return a;
+	}
+	if (priority(b) < priority(a)){
+		std::swap(a, b);
+	}
+
+	BTNode<T>* l;
+	BTNode<T>* found;
+	BTNode<T>* r;
+	split(b, a->x, l, found, r);
+	if (found != nullptr){
+		deleteNode(found);
+		duplicates++;
+	}
+
+	BTNode<T>* al = a->left;
+	BTNode<T>* ar = a->right;
+	int dl = 0;
+	int dr = 0;
+	forkJoin(depth > 0,
+		[&](){ al = unionNodes(al, l, depth-1, dl); },
+		[&](){ ar = unionNodes(ar, r, depth-1, dr); });
+	setChildren(a, al, ar);
+	duplicates += dl + dr;
+	return a;
+}
+
+/**
+* kept counts the values in the result.
+*/
+template <class T>
+BTNode<T>* Treap<T>::intersectNodes(BTNode<T>* a, BTNode<T>* b, int depth, int &kept){
+	if (a == nullptr || b == nullptr){
+		deleteNodes(a);
+		deleteNodes(b);
+		return nullptr;
+	}
+	if (priority(b) < priority(a)){
+		std::swap(a, b);
+	}
+
+	BTNode<T>* l;
+	BTNode<T>* found;
+	BTNode<T>* r;
+	split(b, a->x, l, found, r);
+
+	BTNode<T>* al = a->left;
+	BTNode<T>* ar = a->right;
+	int kl = 0;
+	int kr = 0;
+	forkJoin(depth > 0,
+		[&](){ al = intersectNodes(al, l, depth-1, kl); },
+		[&](){ ar = intersectNodes(ar, r, depth-1, kr); });
+	kept += kl + kr;
+
+	if (found != nullptr){
+		deleteNode(found);
+		setChildren(a, al, ar);
+		kept++;
+		return a;
+	}
+	deleteNode(a);
+	return join(al, ar);
+}
+
+/**
+* The values of a that are not in b. removed counts the
+* values of a that were dropped.
+*/
+template <class T>
+BTNode<T>* Treap<T>::differenceNodes(BTNode<T>* a, BTNode<T>* b, int depth, int &removed){
+	if (a == nullptr || b == nullptr){
+		deleteNodes(b);
+		return a;
+	}
+
+	BTNode<T>* l;
+	BTNode<T>* found;
+	BTNode<T>* r;
+	split(a, b->x, l, found, r);
+	if (found != nullptr){
+		deleteNode(found);
+		removed++;
+	}
+
+	BTNode<T>* bl = b->left;
+	BTNode<T>* br = b->right;
+	deleteNode(b);
+	int rl = 0;
+	int rr = 0;
+	forkJoin(depth > 0,
+		[&](){ l = differenceNodes(l, bl, depth-1, rl); },
+		[&](){ r = differenceNodes(r, br, depth-1, rr); });
+	removed += rl + rr;
+	return join(l, r);
+}
+
+
+template <class T>
+void Treap<T>::unionWith(Treap<T> &b){
+	if (&b == this){
+		return;
+	}
+	int duplicates = 0;
+	this->root = unionNodes(this->root, b.root, forkDepth(n + b.n), duplicates);
+	if (this->root != nullptr){
+		this->root->parent = nullptr;
+	}
+	n += b.n - duplicates;
+	b.root = nullptr;
+	b.n = 0;
+}
+
+template <class T>
+void Treap<T>::intersectWith(Treap<T> &b){
+	if (&b == this){
+		return;
+	}
+	int kept = 0;
+	this->root = intersectNodes(this->root, b.root, forkDepth(n + b.n), kept);
+	if (this->root != nullptr){
+		this->root->parent = nullptr;
+	}
+	n = kept;
+	b.root = nullptr;
+	b.n = 0;
+}
+
+template <class T>
+void Treap<T>::differenceWith(Treap<T> &b){
+	if (&b == this){
+		deleteNodes(this->root);
+		this->root = nullptr;
+		n = 0;
+		return;
+	}
+	int removed = 0;
+	this->root = differenceNodes(this->root, b.root, forkDepth(n + b.n), removed);
+	if (this->root != nullptr){
+		this->root->parent = nullptr;
+	}
+	n -= removed;
+	b.root = nullptr;
+	b.n = 0;
+}
+
+/**
+* Takes O(log(n)) expected time to split, plus time proportional to
+* the number of values moved to count them.
+*/
+template <class T>
+void Treap<T>::splitAt(T x, Treap<T> &b){
+	if (&b == this){
+		return;
+	}
+	deleteNodes(b.root);
+	BTNode<T>* l;
+	BTNode<T>* found;
+	BTNode<T>* r;
+	split(this->root, x, l, found, r);
+	if (found != nullptr){
+		setChildren(found, nullptr, nullptr);
+		l = join(l, found);
+	}
+	if (l != nullptr){
+		l->parent = nullptr;
+	}
+	if (r != nullptr){
+		r->parent = nullptr;
+	}
+	b.root = l;
+	b.n = this->subtreeSize(l);
+	this->root = r;
+	n -= b.n;
+}
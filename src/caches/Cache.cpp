@@ -0,0 +1,186 @@
+/**
+* Shared bookkeeping for LRUCache and LFUCache.
+*
+* The entries live in a DLList, ordered so that the next one to evict
+* is at the back, and a SwissHashMap maps each key to its node. Nodes
+* are never copied or reallocated, so the index stays valid, and every
+* operation is a hash lookup plus a constant number of pointer updates
+* in the list:
+*
+*   index:  k1 -> *   k2 -> *   k3 -> *
+*                 |         |         |
+*                 v         v         v
+*   dummy <-> [k2, v2] <-> [k3, v3] <-> [k1, v1] <-> dummy
+*             kept longest               evicted next
+*
+* The subclasses decide where a new entry goes and where an entry moves
+* when it is used.
+*
+* Each entry has a weight, given to put(), and the total weight never
+* exceeds the capacity. With the default weight of 1 the capacity is a
+* number of entries; passing sizes in bytes gives a capacity in bytes.
+* An entry heavier than the whole capacity is not stored.
+*
+* Performance:
+*
+*         put(k,v): O(1) expected, plus O(1) per eviction
+*        lookup(k): O(1) expected
+*        remove(k): O(1) expected
+*/
+
+#include <stdexcept>
+
+#include "ds/caches.h"
+
+
+template <class K, class V>
+Cache<K, V>::Cache(long capacity): cap(capacity) {}
+
+template <class K, class V>
+int Cache<K, V>::size(){
+	return entries.size();
+}
+
+template <class K, class V>
+long Cache<K, V>::weight(){
+	return w;
+}
+
+template <class K, class V>
+long Cache<K, V>::capacity(){
+	return cap;
+}
+
+/**
+* Putting a key that is already present replaces its value and weight
+* and counts as a use of the entry.
+*/
+template <class K, class V>
+bool Cache<K, V>::put(K k, V v, long bytes){
+	Node** p = index.lookup(k);
+	Node* u = (p == nullptr) ? nullptr : *p;
+
+	if (bytes > cap){
+		if (u != nullptr){
+			removeNode(u);	// Don't leave the old value behind
+		}
+		counts.rejections++;
+		return false;
+	}
+
+	if (u != nullptr){
+		w += bytes - u->x.bytes;
+		u->x.value = v;
+		u->x.bytes = bytes;
+		u->x.uses++;
+		touch(u);
+		while (w > cap){
+			evict(u);
+		}
+		return true;
+	}
+
+	while (w + bytes > cap){
+		evict(nullptr);
+	}
+	CacheEntry<K, V> e;
+	e.key = k;
+	e.value = v;
+	e.bytes = bytes;
+	e.uses = 1;
+	u = entries.addBefore(entries.end(), e);
+	index.put(k, u);
+	w += bytes;
+	placeNew(u);
+	return true;
+}
+
+template <class K, class V>
+V* Cache<K, V>::lookup(K k){
+	Node** p = index.lookup(k);
+	if (p == nullptr){
+		counts.misses++;
+		return nullptr;
+	}
+	Node* u = *p;
+	counts.hits++;
+	u->x.uses++;
+	touch(u);
+	return &u->x.value;
+}
+
+template <class K, class V>
+V Cache<K, V>::get(K k){
+	V* v = lookup(k);
+	if (v == nullptr){
+		throw std::out_of_range("Could not find key");
+	}
+	return *v;
+}
+
+template <class K, class V>
+bool Cache<K, V>::contains(K k){
+	return index.contains(k);
+}
+
+template <class K, class V>
+V Cache<K, V>::remove(K k){
+	Node** p = index.lookup(k);
+	if (p == nullptr){
+		throw std::out_of_range("Could not find key for removal");
+	}
+	Node* u = *p;
+	V v = u->x.value;
+	removeNode(u);
+	return v;
+}
+
+template <class K, class V>
+void Cache<K, V>::clear(){
+	while (entries.size() > 0){
+		removeNode(entries.end()->prev);
+	}
+}
+
+template <class K, class V>
+CacheStats Cache<K, V>::stats(){
+	return counts;
+}
+
+template <class K, class V>
+void Cache<K, V>::resetStats(){
+	counts = CacheStats();
+}
+
+
+template <class K, class V>
+void Cache<K, V>::removeNode(Node* u){
+	unlink(u);
+	index.remove(u->x.key);
+	w -= u->x.bytes;
+	entries.removeNode(u);
+}
+
+/**
+* Evict the entry at the back, or the one before it if that is keep.
+*/
+template <class K, class V>
+void Cache<K, V>::evict(Node* keep){
+	Node* u = entries.end()->prev;
+	if (u == keep){
+		u = u->prev;
+	}
+	removeNode(u);
+	counts.evictions++;
+}
+
+
+template <class K, class V>
+long Cache<K, V>::bytesUsed(){
+	return (long)entries.size() * (sizeof(K) + sizeof(V));
+}
+
+template <class K, class V>
+long Cache<K, V>::bytesReserved(){
+	return entries.bytesReserved() + index.bytesReserved();
+}
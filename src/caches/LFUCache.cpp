@@ -0,0 +1,101 @@
+/**
+* Least frequently used cache.
+*
+* The list is sorted by use count, highest at the front, and entries
+* with the same count are in order of their last use, most recent
+* first. The entry at the back has the fewest uses, and of those, has
+* gone unused the longest.
+*
+* A use moves an entry from the group with count f to the group with
+* count f+1, which sits just in front of it. To find the front of a
+* group without walking the list, heads maps each count to its first
+* node:
+*
+*   heads:    3 -> *         1 -> *
+*                  |              |
+*                  v              v
+*   dummy <-> [a,3] <-> [b,3] <-> [c,1] <-> [d,1] <-> dummy
+*
+*   after using d:
+*
+*   heads:    3 -> *         2 -> *    1 -> *
+*                  |              |         |
+*                  v              v         v
+*   dummy <-> [a,3] <-> [b,3] <-> [d,2] <-> [c,1] <-> dummy
+*
+* Counts are never decayed, so an entry that was popular long ago
+* stays cached until it is removed or outlived by more popular ones.
+*
+* Performance:
+*
+*         put(k,v): O(1) expected, plus O(1) per eviction
+*        lookup(k): O(1) expected
+*        remove(k): O(1) expected
+*/
+
+#include "ds/caches.h"
+
+
+template <class K, class V>
+LFUCache<K, V>::LFUCache(long capacity): Cache<K, V>(capacity) {}
+
+/**
+* u is at the back with a count of 1. Every other entry has a count of
+* at least 1, so u only needs to move if there are others with 1.
+*/
+template <class K, class V>
+void LFUCache<K, V>::placeNew(Node* u){
+	Node** h = heads.lookup(1);
+	if (h != nullptr){
+		this->entries.moveBefore(u, *h);
+	}
+	heads.put(1, u);
+}
+
+/**
+* u's count has gone from f to f+1. It goes to the front of group
+* f+1, or, if there is no such group, to the front of group f.
+*/
+template <class K, class V>
+void LFUCache<K, V>::touch(Node* u){
+	long f = u->x.uses - 1;
+	Node** h = heads.lookup(f + 1);
+	Node* target = (h == nullptr) ? nullptr : *h;
+	Node* first = *heads.lookup(f);
+
+	advanceHead(u, f);
+	if (target != nullptr){
+		this->entries.moveBefore(u, target);
+	} else if (first != u){
+		this->entries.moveBefore(u, first);
+	}
+	heads.put(f + 1, u);
+}
+
+template <class K, class V>
+void LFUCache<K, V>::unlink(Node* u){
+	advanceHead(u, u->x.uses);
+}
+
+/**
+* u is leaving group f. If it was the group's first node, the next
+* node takes over, or the group is gone.
+*/
+template <class K, class V>
+void LFUCache<K, V>::advanceHead(Node* u, long f){
+	if (*heads.lookup(f) != u){
+		return;
+	}
+	Node* next = u->next;
+	if (next != this->entries.end() && next->x.uses == f){
+		heads.put(f, next);
+	} else {
+		heads.remove(f);
+	}
+}
+
+
+template <class K, class V>
+long LFUCache<K, V>::bytesReserved(){
+	return Cache<K, V>::bytesReserved() + heads.bytesReserved();
+}
@@ -0,0 +1,32 @@
+/**
+* Least recently used cache.
+*
+* New and used entries move to the front of the list, so the entry at
+* the back is the one that has gone unused the longest. See Cache.cpp
+* for the rest.
+*
+* Performance:
+*
+*         put(k,v): O(1) expected, plus O(1) per eviction
+*        lookup(k): O(1) expected
+*        remove(k): O(1) expected
+*/
+
+#include "ds/caches.h"
+
+
+template <class K, class V>
+LRUCache<K, V>::LRUCache(long capacity): Cache<K, V>(capacity) {}
+
+template <class K, class V>
+void LRUCache<K, V>::placeNew(Node* u){
+	this->entries.moveBefore(u, this->entries.end()->next);
+}
+
+template <class K, class V>
+void LRUCache<K, V>::touch(Node* u){
+	this->entries.moveBefore(u, this->entries.end()->next);
+}
+
+template <class K, class V>
+void LRUCache<K, V>::unlink(Node*){}
@@ -0,0 +1,257 @@
+/**
+* Bounded blocking queue.
+*
+* The elements sit in a fixed ring, indexed like ArrayQueue's: the
+* oldest at j, the rest following it modulo the capacity. Since the
+* queue is bounded the ring never resizes, so nothing is allocated
+* while the lock is held.
+*
+* One mutex guards the ring, with a condition variable for each side:
+*
+*   producers wait on notFull   while n == capacity
+*   consumers wait on notEmpty  while n == 0
+*
+* Wakeups are only sent when a thread is actually waiting, which the
+* waitingProducers and waitingConsumers counts record, and they are
+* sent after the lock is released so the woken thread doesn't block
+* on it straight away. A queue that stays busy therefore makes no
+* futex calls at all. dequeueBulk() frees many slots under one lock
+* acquisition and wakes that many producers (at most) in one go.
+*
+* close() stops further enqueues and wakes everyone. Consumers keep
+* taking what is left, and only see the queue as finished once it is
+* both closed and empty:
+*
+*   producer:  q.enqueue(x) ... q.close()
+*   consumer:  while ((m = q.dequeueBulk(buf, k)) > 0) process(buf, m)
+*
+* Performance:
+*
+*       enqueue(x):  O(1), plus any waiting
+*        dequeue():  O(1), plus any waiting
+*   dequeueBulk(k):  O(k), with one lock acquisition
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "ds/concurrency.h"
+
+
+template <class T>
+BlockingQueue<T>::BlockingQueue(int capacity): a(capacity) {
+	if (capacity < 1){
+		throw std::invalid_argument("capacity must be at least 1");
+	}
+}
+
+/**
+* push() and pop() assume the lock is held and there is room (or
+* an element).
+*/
+template <class T>
+void BlockingQueue<T>::push(T x){
+	a[(j+n) % a.length()] = std::move(x);
+	n++;
+}
+
+template <class T>
+T BlockingQueue<T>::pop(){
+	T x = std::move(a[j]);
+	j = (j+1) % a.length();
+	n--;
+	return x;
+}
+
+/**
+* Both release the lock before notifying.
+*/
+template <class T>
+void BlockingQueue<T>::wakeConsumer(std::unique_lock<std::mutex> &held){
+	bool waiting = waitingConsumers > 0;
+	held.unlock();
+	if (waiting){
+		notEmpty.notify_one();
+	}
+}
+
+template <class T>
+void BlockingQueue<T>::wakeProducers(std::unique_lock<std::mutex> &held, int freed){
+	int waiting = std::min(waitingProducers, freed);
+	held.unlock();
+	for (int k = 0; k < waiting; k++){
+		notFull.notify_one();	// notify_all would wake every producer to fight over the freed slots
+	}
+}
+
+
+template <class T>
+int BlockingQueue<T>::size(){
+	std::lock_guard<std::mutex> held(lock);
+	return n;
+}
+
+template <class T>
+int BlockingQueue<T>::capacity(){
+	return a.length();
+}
+
+
+template <class T>
+void BlockingQueue<T>::enqueue(T x){
+	std::unique_lock<std::mutex> held(lock);
+	while (n == a.length() && !isClosed){
+		waitingProducers++;
+		notFull.wait(held);
+		waitingProducers--;
+	}
+	if (isClosed){
+		throw std::logic_error("queue is closed");
+	}
+	push(std::move(x));
+	wakeConsumer(held);
+}
+
+template <class T>
+T BlockingQueue<T>::dequeue(){
+	std::unique_lock<std::mutex> held(lock);
+	while (n == 0 && !isClosed){
+		waitingConsumers++;
+		notEmpty.wait(held);
+		waitingConsumers--;
+	}
+	if (n == 0){
+		throw std::out_of_range("queue is closed and empty");
+	}
+	T x = pop();
+	wakeProducers(held, 1);
+	return x;
+}
+
+template <class T>
+bool BlockingQueue<T>::tryEnqueue(T x){
+	std::unique_lock<std::mutex> held(lock);
+	if (n == a.length() || isClosed){
+		return false;
+	}
+	push(std::move(x));
+	wakeConsumer(held);
+	return true;
+}
+
+template <class T>
+bool BlockingQueue<T>::tryDequeue(T &x){
+	std::unique_lock<std::mutex> held(lock);
+	if (n == 0){
+		return false;
+	}
+	x = pop();
+	wakeProducers(held, 1);
+	return true;
+}
+
+/**
+* The timed versions return false if the timeout passes first, or
+* (for tryEnqueueFor) if the queue is closed.
+*/
+template <class T>
+template <class Rep, class Period>
+bool BlockingQueue<T>::tryEnqueueFor(T x, std::chrono::duration<Rep, Period> timeout){
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+	std::unique_lock<std::mutex> held(lock);
+	while (n == a.length() && !isClosed){
+		waitingProducers++;
+		std::cv_status status = notFull.wait_until(held, deadline);
+		waitingProducers--;
+		if (status == std::cv_status::timeout && n == a.length()){
+			return false;
+		}
+	}
+	if (isClosed){
+		return false;
+	}
+	push(std::move(x));
+	wakeConsumer(held);
+	return true;
+}
+
+template <class T>
+template <class Rep, class Period>
+bool BlockingQueue<T>::tryDequeueFor(T &x, std::chrono::duration<Rep, Period> timeout){
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+	std::unique_lock<std::mutex> held(lock);
+	while (n == 0 && !isClosed){
+		waitingConsumers++;
+		std::cv_status status = notEmpty.wait_until(held, deadline);
+		waitingConsumers--;
+		if (status == std::cv_status::timeout && n == 0){
+			return false;
+		}
+	}
+	if (n == 0){
+		return false;
+	}
+	x = pop();
+	wakeProducers(held, 1);
+	return true;
+}
+
+
+/**
+* Takes everything available, up to k, without letting go of the lock.
+*/
+template <class T>
+int BlockingQueue<T>::dequeueBulk(T* out, int k){
+	std::unique_lock<std::mutex> held(lock);
+	while (n == 0 && !isClosed){
+		waitingConsumers++;
+		notEmpty.wait(held);
+		waitingConsumers--;
+	}
+	int m = std::min(n, k);
+	for (int i = 0; i < m; i++){
+		out[i] = pop();
+	}
+	wakeProducers(held, m);
+	return m;
+}
+
+template <class T>
+int BlockingQueue<T>::tryDequeueBulk(T* out, int k){
+	std::unique_lock<std::mutex> held(lock);
+	int m = std::min(n, k);
+	for (int i = 0; i < m; i++){
+		out[i] = pop();
+	}
+	wakeProducers(held, m);
+	return m;
+}
+
+
+template <class T>
+void BlockingQueue<T>::close(){
+	{
+		std::lock_guard<std::mutex> held(lock);
+		isClosed = true;
+	}
+	notEmpty.notify_all();
+	notFull.notify_all();
+}
+
+template <class T>
+bool BlockingQueue<T>::closed(){
+	std::lock_guard<std::mutex> held(lock);
+	return isClosed;
+}
+
+template <class T>
+long BlockingQueue<T>::bytesUsed(){
+	std::lock_guard<std::mutex> held(lock);
+	return (long)n * sizeof(T);
+}
+
+template <class T>
+long BlockingQueue<T>::bytesReserved(){
+	return (long)a.length() * sizeof(T);
+}
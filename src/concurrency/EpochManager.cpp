@@ -0,0 +1,150 @@
+/**
+* Epoch-based reclamation.
+*
+* A global epoch counter only moves from e to e+1 once every thread
+* that is currently inside a critical section has seen e. Each retired
+* node is tagged with the epoch at the time it was unlinked, t.
+*
+*   - a reader that can still see the node entered at epoch t or earlier
+*   - the global epoch can't pass t+1 until all those readers have left
+*
+* So once the global epoch reaches t+2, nobody can hold a reference to
+* the node and it can be freed.
+*
+* Readers only write to their own thread record, so enter() and exit()
+* never block or retry, and the reading side of the concurrent
+* containers remains wait-free. Freeing happens in batches, every
+* collectInterval retirements.
+*/
+
+#include "ds/concurrency.h"
+
+
+inline EpochManager& EpochManager::instance(){
+	static EpochManager manager;
+	return manager;
+}
+
+/**
+* Only runs at process exit, once no other threads are using the
+* concurrent containers.
+*/
+inline EpochManager::~EpochManager(){
+	unsigned long never = (unsigned long)-1;
+	freeRetired(orphans, never);
+	ThreadRecord* r = records.load();
+	while (r != nullptr){
+		ThreadRecord* next = r->next;
+		freeRetired(r->retired, never);
+		delete r;
+		r = next;
+	}
+}
+
+/**
+* Records are never freed while the program is running. When a thread
+* exits, its record is marked unused and can be claimed by a new thread.
+*/
+inline EpochManager::ThreadRecord* EpochManager::record(){
+	static thread_local ThreadHandle handle;
+	if (handle.record != nullptr){
+		return handle.record;
+	}
+
+	for (ThreadRecord* r = records.load(); r != nullptr; r = r->next){
+		bool unused = false;
+		if (!r->inUse.load() && r->inUse.compare_exchange_strong(unused, true)){
+			handle.record = r;
+			return r;
+		}
+	}
+
+	ThreadRecord* r = new ThreadRecord();
+	r->epoch.store(0);
+	r->active.store(false);
+	r->inUse.store(true);
+	r->nesting = 0;
+	r->next = records.load();
+	while (!records.compare_exchange_weak(r->next, r)) {}
+	handle.record = r;
+	return r;
+}
+
+inline EpochManager::ThreadHandle::~ThreadHandle(){
+	if (record == nullptr){
+		return;
+	}
+	EpochManager& m = EpochManager::instance();
+	{
+		std::lock_guard<std::mutex> guard(m.orphanLock);
+		m.orphans.insert(m.orphans.end(), record->retired.begin(), record->retired.end());
+	}
+	record->retired.clear();
+	record->active.store(false);
+	record->inUse.store(false);
+}
+
+
+inline void EpochManager::enter(){
+	ThreadRecord* r = record();
+	if (r->nesting++ == 0){
+		r->active.store(true);
+		r->epoch.store(globalEpoch.load());
+	}
+}
+
+inline void EpochManager::exit(){
+	ThreadRecord* r = record();
+	if (--r->nesting == 0){
+		r->active.store(false);
+	}
+}
+
+/**
+* Call after p has been unlinked, so that no new reader can find it.
+*/
+inline void EpochManager::retire(void* p, void (*deleter)(void*)){
+	ThreadRecord* r = record();
+	Retired item = {p, deleter, globalEpoch.load()};
+	r->retired.push_back(item);
+	if (r->retired.size() % collectInterval == 0){
+		collect();
+	}
+}
+
+inline void EpochManager::collect(){
+	tryAdvance();
+	unsigned long e = globalEpoch.load();
+	freeRetired(record()->retired, e);
+
+	std::unique_lock<std::mutex> guard(orphanLock, std::try_to_lock);
+	if (guard.owns_lock() && !orphans.empty()){
+		freeRetired(orphans, e);
+	}
+}
+
+inline bool EpochManager::tryAdvance(){
+	unsigned long e = globalEpoch.load();
+	for (ThreadRecord* r = records.load(); r != nullptr; r = r->next){
+		if (r->active.load() && r->epoch.load() != e){
+			return false;	// Someone is still reading in an older epoch
+		}
+	}
+	return globalEpoch.compare_exchange_strong(e, e+1);
+}
+
+/**
+* Free everything retired at least two epochs before e,
+* keeping the rest in their original order.
+*/
+inline void EpochManager::freeRetired(std::vector<Retired> &retired, unsigned long e){
+	size_t kept = 0;
+	for (size_t i = 0; i < retired.size(); i++){
+		if (e == (unsigned long)-1 || retired[i].epoch + 2 <= e){
+			retired[i].deleter(retired[i].p);
+		} else {
+			retired[kept++] = retired[i];
+		}
+	}
+	retired.resize(kept);
+}
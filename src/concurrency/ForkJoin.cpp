@@ -0,0 +1,98 @@
+/**
+* Minimal fork-join support for divide and conquer algorithms.
+*
+* forkJoin() runs its two tasks on separate threads when asked to,
+* and waits for both before returning. Recursive algorithms pass down
+* a depth budget and only fork while it is positive, so the number of
+* threads is bounded by 2^depth. Each task must only touch data that
+* the other doesn't. This is a plain thread per fork, not a
+* work-stealing pool; the depth budget is what keeps the thread count
+* down.
+*
+* An exception thrown by either task, eg std::bad_alloc, is passed to
+* the caller once both tasks have finished. If both throw, the one
+* from left is rethrown.
+*
+* forkEach() is the flat version, for work that is already split into
+* a fixed number of independent tasks.
+*
+* forkDepth() picks the budget: enough levels to give every core a few
+* tasks (so uneven splits still keep the cores busy), but no more than
+* the input size justifies, since starting a thread costs about as
+* much as a few thousand simple operations.
+*/
+
+#include <exception>
+#include <thread>
+
+#include "ds/concurrency.h"
+
+
+template <class F1, class F2>
+void forkJoin(bool fork, F1 left, F2 right){
+	if (!fork){
+		left();
+		right();
+		return;
+	}
+	std::exception_ptr leftError;
+	std::thread t([&](){
+		try {
+			left();
+		} catch(...){
+			leftError = std::current_exception();
+		}
+	});
+	try {
+		right();
+	} catch(...){
+		t.join();
+		if (leftError){
+			std::rethrow_exception(leftError);
+		}
+		throw;
+	}
+	t.join();
+	if (leftError){
+		std::rethrow_exception(leftError);
+	}
+}
+
+/**
+* Splits the tasks in half and forks until each half is a single task.
+*/
+template <class F>
+void forkEachRange(int lo, int hi, F f){
+	if (hi - lo == 1){
+		f(lo);
+		return;
+	}
+	int mid = lo + (hi - lo) / 2;
+	forkJoin(true,
+		[=](){ forkEachRange(lo, mid, f); },
+		[=](){ forkEachRange(mid, hi, f); });
+}
+
+template <class F>
+void forkEach(int tasks, F f){
+	if (tasks > 0){
+		forkEachRange(0, tasks, f);
+	}
+}
+
+inline int forkDepth(long n){
+	const long grain = 4096;
+	int cores = std::thread::hardware_concurrency();
+	int depth = 0;
+	while ((1 << depth) < cores){
+		depth++;
+	}
+	if (depth > 0){
+		depth += 2;
+	}
+	int sizeDepth = 0;
+	while ((grain << sizeDepth) <= n){
+		sizeDepth++;
+	}
+	return (depth < sizeDepth) ? depth : sizeDepth;
+}
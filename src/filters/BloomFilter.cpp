@@ -0,0 +1,152 @@
+/**
+* Blocked Bloom filter.
+*
+* A Bloom filter is an array of bits. Adding a value sets k bits chosen
+* by hashing it, and a lookup checks whether all k of those bits are
+* set. If any is clear the value was definitely never added; if all
+* are set it probably was, but they may have been set by other values
+* (a false positive). With b bits per value and k chosen well, the
+* false positive rate is about 0.6185^b, eg 1% for 9.6 bits per value.
+*
+* In a plain Bloom filter the k bits are spread over the whole array,
+* so a lookup costs up to k cache misses. Here the first hash picks one
+* 512-bit block (a cache line) and all k bits are chosen within it, so
+* every lookup touches a single cache line:
+*
+*   block:   0          1          2          3
+*          [........][..1..1.1][........][........]    add(x), k = 3
+*                        ^ hash(x) picks block 1, then 3 bits in it
+*
+* Some blocks end up with more values than others, which raises the
+* false positive rate a little, so 20% more bits are allocated than a
+* plain filter would need.
+*
+* Values can't be removed, since their bits may be shared with other
+* values. Filling the filter beyond its capacity doesn't cause false
+* negatives, but the false positive rate rises; falsePositiveRate()
+* estimates it from the fraction of bits set (reading a little low,
+* since it ignores the uneven blocks).
+*
+* Performance:
+*
+*           add(x): O(k), one cache line
+*   mightContain(x): O(k), one cache line
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+#include "ds/filters.h"
+
+
+/**
+* Uses the 64-bit finalizer from MurmurHash3, since std::hash is often
+* the identity for integers.
+*/
+template <class T>
+unsigned long long BloomFilter<T>::hash(const T &x){
+	unsigned long long h = std::hash<T>()(x);
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdull;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ull;
+	h ^= h >> 33;
+	return h;
+}
+
+template <class T>
+BloomFilter<T>::BloomFilter(int capacity, double falsePositiveRate){
+	if (!(falsePositiveRate > 0 && falsePositiveRate < 1)){
+		throw std::invalid_argument("bloom filter needs 0 < falsePositiveRate < 1");
+	}
+	const double ln2 = std::log(2.0);
+	double bitsPerValue = -std::log(falsePositiveRate) / (ln2 * ln2);
+	k = std::max(1, (int)std::lround(bitsPerValue * ln2));
+	double bits = 1.2 * bitsPerValue * std::max(capacity, 1);
+	nBlocks = std::max(1, (int)std::ceil(bits / (64 * blockWords)));
+
+	// One spare block's worth of words so the blocks can start on a cache line
+	storage = Array<unsigned long long>(blockWords * (nBlocks + 1));
+	uintptr_t p = reinterpret_cast<uintptr_t>(&storage[0]);
+	blocks = reinterpret_cast<unsigned long long*>((p + 63) & ~(uintptr_t)63);
+	clear();
+}
+
+template <class T>
+void BloomFilter<T>::clear(){
+	for (int i = 0; i < storage.length(); i++){
+		storage[i] = 0;
+	}
+	n = 0;
+}
+
+/**
+* The high half of the hash picks the block. The bit positions are
+* the top 9 bits of a multiplicative sequence seeded from the whole
+* hash, which are close to independent of each other and the block.
+*/
+template <class T>
+void BloomFilter<T>::add(T x){
+	unsigned long long h = hash(x);
+	unsigned long long* block = blocks + blockWords * (int)(((h >> 32) * nBlocks) >> 32);
+	unsigned long long g = h * golden;
+	for (int i = 0; i < k; i++){
+		unsigned bit = g >> 55;
+		block[bit >> 6] |= 1ull << (bit & 63);
+		g = g * golden + (h | 1);
+	}
+	n++;
+}
+
+template <class T>
+bool BloomFilter<T>::mightContain(T x){
+	unsigned long long h = hash(x);
+	const unsigned long long* block = blocks + blockWords * (int)(((h >> 32) * nBlocks) >> 32);
+	unsigned long long g = h * golden;
+	for (int i = 0; i < k; i++){
+		unsigned bit = g >> 55;
+		if (!(block[bit >> 6] & (1ull << (bit & 63)))){
+			return false;
+		}
+		g = g * golden + (h | 1);
+	}
+	return true;
+}
+
+template <class T>
+int BloomFilter<T>::size(){
+	return n;
+}
+
+template <class T>
+long BloomFilter<T>::bytesUsed(){
+	return (long)nBlocks * blockWords * sizeof(unsigned long long);
+}
+
+/**
+* Includes the spare block that lets the blocks start on a cache line.
+*/
+template <class T>
+long BloomFilter<T>::bytesReserved(){
+	return (long)storage.length() * sizeof(unsigned long long);
+}
+
+template <class T>
+double BloomFilter<T>::fillRatio(){
+	long set = 0;
+	for (int i = 0; i < blockWords * nBlocks; i++){
+		set += __builtin_popcountll(blocks[i]);
+	}
+	return (double)set / (64.0 * blockWords * nBlocks);
+}
+
+/**
+* A lookup of an absent value is a false positive when all k of its
+* bits happen to be set.
+*/
+template <class T>
+double BloomFilter<T>::falsePositiveRate(){
+	return std::pow(fillRatio(), k);
+}
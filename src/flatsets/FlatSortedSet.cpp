@@ -0,0 +1,218 @@
+/**
+* Sorted set in a sorted array.
+*
+* The values are kept in order in a FastArrayStack, so find(x) is a
+* binary search over contiguous memory: no node allocations, no
+* pointers to chase, and n values take n slots (plus slack). For small
+* and read-mostly sets that beats a Treap by a wide margin.
+*
+* The binary search is branchless. Each step halves the range with a
+* conditional move instead of a branch, so there is nothing for the
+* CPU to mispredict, and the loop runs log(n) times whatever x is:
+*
+*   base = 0, len = 8:  [ 4  8 15 16 23 42 50 61 ]   x = 23
+*   half = 4:  b[4] = 23 < x? no  -> base = 0, len = 4
+*   half = 2:  b[2] = 15 < x? yes -> base = 2, len = 2
+*   half = 1:  b[3] = 16 < x? yes -> base = 3, len = 1
+*   b[3] < x, so the answer is index 4
+*
+* Adding to a sorted array means shifting everything after the new
+* value along, O(n) per add. Instead, new values go into a second,
+* small sorted array (pending) of up to about sqrt(n) values, where
+* the shifting is cheap. When that fills up, the two arrays are merged
+* from the back into the main one in a single pass, so each merge is
+* O(n) for about sqrt(n) adds. Lookups search both arrays.
+*
+* addAll() sorts its input and merges it in one pass, which is the
+* fastest way to build a set from unsorted values.
+*
+* Performance:
+*
+* 				Worst case		Amortized
+*        add(x):   O(n)			O(log(n) + sqrt(n))
+*     remove(x):   O(n)			O(n)
+*       find(x):   O(log(n))	O(log(n))
+*   addAll(xs,m):  O(n + m log(m))
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "ds/flat_sets.h"
+
+
+template <class T>
+int FlatSortedSet<T>::lowerBound(const T* b, int n, const T& x){
+	if (n == 0){
+		return 0;
+	}
+	const T* base = b;
+	int len = n;
+	while (len > 1){
+		int half = len / 2;
+		base = (base[half] < x) ? base + half : base;
+		len -= half;
+	}
+	return (base - b) + (*base < x);
+}
+
+template <class T>
+int FlatSortedSet<T>::pendingLimit(){
+	return std::max(32, (int)std::sqrt((double)a.n));
+}
+
+/**
+* Merges from the back, so the main array only needs to grow
+* and no element is moved more than once.
+*
+*   a:        4 15 23 42 _ _     pending: 8 16
+*   a:        4 15 23 _ _ 42
+*   a:        4 15 _ _ 23 42
+*   a:        4 15 _ 16 23 42
+*   a:        4 _ 15 16 23 42
+*   a:        4 8 15 16 23 42
+*/
+template <class T>
+void FlatSortedSet<T>::merge(){
+	int n = a.n;
+	int m = pending.n;
+	if (m == 0){
+		return;
+	}
+	if (n + m > a.capacity()){
+		a.reserve(std::max(n + m, 2 * a.capacity()));
+	}
+	T* b = &a.a[0];
+	T* p = &pending.a[0];
+	int i = n - 1;
+	int j = m - 1;
+	for (int k = n + m - 1; j >= 0; k--){
+		if (i >= 0 && p[j] < b[i]){
+			b[k] = std::move(b[i--]);
+		} else {
+			b[k] = std::move(p[j--]);
+		}
+	}
+	a.n = n + m;
+	pending.n = 0;	// Keep pending's array for the next batch
+}
+
+
+template <class T>
+int FlatSortedSet<T>::size(){
+	return a.n + pending.n;
+}
+
+template <class T>
+bool FlatSortedSet<T>::add(T x){
+	int i = lowerBound(&a.a[0], a.n, x);
+	if (i < a.n && !(x < a.a[i])){
+		return false;
+	}
+	int j = lowerBound(&pending.a[0], pending.n, x);
+	if (j < pending.n && !(x < pending.a[j])){
+		return false;
+	}
+	pending.add(j, std::move(x));
+	if (pending.n >= pendingLimit()){
+		merge();
+	}
+	return true;
+}
+
+template <class T>
+T FlatSortedSet<T>::remove(T x){
+	int j = lowerBound(&pending.a[0], pending.n, x);
+	if (j < pending.n && !(x < pending.a[j])){
+		return pending.remove(j);
+	}
+	int i = lowerBound(&a.a[0], a.n, x);
+	if (i < a.n && !(x < a.a[i])){
+		return a.remove(i);
+	}
+	throw std::out_of_range("Could not find x for removal");
+}
+
+/**
+* The successor of x in each array, whichever is smaller.
+*/
+template <class T>
+T FlatSortedSet<T>::find(const T& x){
+	int i = lowerBound(&a.a[0], a.n, x);
+	int j = lowerBound(&pending.a[0], pending.n, x);
+	bool inMain = i < a.n;
+	bool inPending = j < pending.n;
+	if (!inMain && !inPending){
+		throw std::out_of_range("No values larger than x in set");
+	}
+	if (inMain && (!inPending || a.a[i] < pending.a[j])){
+		return a.a[i];
+	}
+	return pending.a[j];
+}
+
+template <class T>
+bool FlatSortedSet<T>::contains(const T& x){
+	int i = lowerBound(&a.a[0], a.n, x);
+	if (i < a.n && !(x < a.a[i])){
+		return true;
+	}
+	int j = lowerBound(&pending.a[0], pending.n, x);
+	return j < pending.n && !(x < pending.a[j]);
+}
+
+
+/**
+* xs is copied and sorted, then merged with the main array into a new
+* one, skipping duplicates, in a single pass. Values already pending
+* are merged in first.
+*/
+template <class T>
+int FlatSortedSet<T>::addAll(const T* xs, int m){
+	if (m == 0){
+		return 0;
+	}
+	merge();
+	Array<T> c(m);
+	std::copy(xs, xs + m, &c[0]);
+	quickSort(&c[0], m);
+
+	int n = a.n;
+	Array<T> b(std::max(n + m, 1));
+	T* old = &a.a[0];
+	int i = 0;
+	int j = 0;
+	int k = 0;
+	while (i < n || j < m){
+		if (j == m || (i < n && old[i] < c[j])){
+			b[k++] = std::move(old[i++]);
+		} else if (i < n && !(c[j] < old[i])){
+			j++;	// Already in the set
+		} else if (k > 0 && !(b[k-1] < c[j])){
+			j++;	// Repeated in xs
+		} else {
+			b[k++] = std::move(c[j++]);
+		}
+	}
+	a.a = std::move(b);
+	a.n = k;
+	return k - n;
+}
+
+template <class T>
+void FlatSortedSet<T>::compact(){
+	merge();
+}
+
+
+template <class T>
+long FlatSortedSet<T>::bytesUsed(){
+	return (long)size() * sizeof(T);
+}
+
+template <class T>
+long FlatSortedSet<T>::bytesReserved(){
+	return a.bytesReserved() + pending.bytesReserved();
+}
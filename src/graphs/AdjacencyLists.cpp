@@ -0,0 +1,96 @@
+/**
+* Graph stored as a list of out-neighbours for each vertex.
+*
+*   0: 1         0 -> 1
+*   1: 2         1 -> 2
+*   2: 0 1       2 -> 0, 2 -> 1
+*
+* The space used is proportional to the number of edges, and listing
+* the edges out of a vertex only touches those edges, so this suits
+* large sparse graphs. Finding a particular edge means scanning the
+* list of its source, and finding the edges into a vertex means
+* scanning every list.
+*
+* Each list is an ArrayStack, so new edges are added at the end.
+*
+* Performance:
+*
+*       addEdge(i, j): O(1) amortized
+*    removeEdge(i, j): O(deg(i))
+*       hasEdge(i, j): O(deg(i))
+*   outEdges(i, list): O(deg(i))
+*    inEdges(i, list): O(n + m)
+*/
+
+#include <algorithm>
+
+#include "ds/graphs.h"
+
+
+inline AdjacencyLists::AdjacencyLists(int _n): n(_n), adj(std::max(_n, 1)) {}
+
+inline int AdjacencyLists::nVertices(){
+	return n;
+}
+
+inline void AdjacencyLists::addEdge(int i, int j){
+	adj[i].push(j);
+}
+
+inline void AdjacencyLists::removeEdge(int i, int j){
+	ArrayStack<int> &edges = adj[i];
+	for (int k = 0; k < edges.size(); k++){
+		if (edges.get(k) == j){
+			edges.remove(k);
+			return;
+		}
+	}
+}
+
+inline bool AdjacencyLists::hasEdge(int i, int j){
+	ArrayStack<int> &edges = adj[i];
+	for (int k = 0; k < edges.size(); k++){
+		if (edges.get(k) == j){
+			return true;
+		}
+	}
+	return false;
+}
+
+inline void AdjacencyLists::outEdges(int i, IList<int> &edges){
+	for (int k = 0; k < adj[i].size(); k++){
+		edges.add(edges.size(), adj[i].get(k));
+	}
+}
+
+inline void AdjacencyLists::inEdges(int i, IList<int> &edges){
+	for (int j = 0; j < n; j++){
+		if (hasEdge(j, i)){
+			edges.add(edges.size(), j);
+		}
+	}
+}
+
+template <class F>
+void AdjacencyLists::forEachOutEdge(int i, F f){
+	ArrayStack<int> &edges = adj[i];
+	for (int k = 0; k < edges.size(); k++){
+		f(edges.get(k), 1);
+	}
+}
+
+inline long AdjacencyLists::bytesUsed(){
+	long used = 0;
+	for (int i = 0; i < n; i++){
+		used += adj[i].bytesUsed();
+	}
+	return used;
+}
+
+inline long AdjacencyLists::bytesReserved(){
+	long reserved = (long)adj.length() * sizeof(ArrayStack<int>);
+	for (int i = 0; i < adj.length(); i++){
+		reserved += adj[i].bytesReserved();
+	}
+	return reserved;
+}
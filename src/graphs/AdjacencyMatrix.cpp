@@ -0,0 +1,105 @@
+/**
+* Graph stored as an n x n matrix of booleans.
+*
+* Entry (i, j) is set when there is an edge from i to j. The rows are
+* stored one after another in a single array:
+*
+*     0 1 2
+*   0 _ 1 _     0 -> 1
+*   1 _ _ 1     1 -> 2
+*   2 1 1 _     2 -> 0, 2 -> 1
+*
+* Testing for, adding and removing a single edge is a matter of
+* reading or writing one entry, but listing the edges of a vertex
+* has to scan a whole row (or column), and the matrix takes n^2
+* space however few edges there are. So this suits small or
+* dense graphs.
+*
+* Performance:
+*
+*       addEdge(i, j): O(1)
+*    removeEdge(i, j): O(1)
+*       hasEdge(i, j): O(1)
+*   outEdges(i, list): O(n)
+*    inEdges(i, list): O(n)
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "ds/graphs.h"
+
+
+inline AdjacencyMatrix::AdjacencyMatrix(int _n): n(_n), a(std::max(_n*_n, 1)) {
+	for (int k = 0; k < a.length(); k++){
+		a[k] = 0;
+	}
+}
+
+inline void AdjacencyMatrix::check(int i, int j){
+	if (i < 0 || i >= n || j < 0 || j >= n){
+		throw std::out_of_range("vertex is outside the graph");
+	}
+}
+
+inline int AdjacencyMatrix::nVertices(){
+	return n;
+}
+
+inline void AdjacencyMatrix::addEdge(int i, int j){
+	check(i, j);
+	m += !a[i*n + j];
+	a[i*n + j] = 1;
+}
+
+inline void AdjacencyMatrix::removeEdge(int i, int j){
+	check(i, j);
+	m -= a[i*n + j];
+	a[i*n + j] = 0;
+}
+
+inline bool AdjacencyMatrix::hasEdge(int i, int j){
+	check(i, j);
+	return a[i*n + j];
+}
+
+inline void AdjacencyMatrix::outEdges(int i, IList<int> &edges){
+	check(i, i);
+	for (int j = 0; j < n; j++){
+		if (a[i*n + j]){
+			edges.add(edges.size(), j);
+		}
+	}
+}
+
+inline void AdjacencyMatrix::inEdges(int i, IList<int> &edges){
+	check(i, i);
+	for (int j = 0; j < n; j++){
+		if (a[j*n + i]){
+			edges.add(edges.size(), j);
+		}
+	}
+}
+
+template <class F>
+void AdjacencyMatrix::forEachOutEdge(int i, F f){
+	check(i, i);
+	const char* row = &a[0] + i*n;
+	for (int j = 0; j < n; j++){
+		if (row[j]){
+			f(j, 1);
+		}
+	}
+}
+
+inline long AdjacencyMatrix::bytesUsed(){
+	return (long)m * sizeof(int);
+}
+
+/**
+* One byte per pair of vertices, so less than bytesUsed() once the
+* graph is dense enough.
+*/
+inline long AdjacencyMatrix::bytesReserved(){
+	return (long)a.length() * sizeof(char);
+}
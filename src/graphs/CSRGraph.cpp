@@ -0,0 +1,185 @@
+/**
+* Graph stored in compressed sparse row (CSR) format.
+*
+* The targets of all the edges are stored in one array, grouped by
+* source vertex, and a second array records where each group starts:
+*
+*   edges 0->1, 1->2, 2->0, 2->1
+*
+*   outStart:  0 1 2 4        (one entry per vertex, plus the end)
+*   outTarget: 1 2 0 1
+*              ^ ^ ^---^
+*              0 1   2
+*
+* The edges of a vertex are contiguous, and sorted by target, so a
+* traversal reads memory sequentially instead of chasing a pointer
+* per vertex, and the whole graph takes two allocations. The same is
+* done with the edges grouped by target, giving fast access to in-edges
+* (which the bottom-up steps of parallelBFS need).
+*
+* The grouping is done with two passes of counting sort, one by target
+* and then one by source. Each pass is stable, so within a group the
+* edges end up sorted.
+*
+* The price is that the graph can't change after it's built.
+*
+* Performance:
+*
+*        CSRGraph(...): O(n + m)
+*       hasEdge(i, j): O(log(deg(i)))
+*   forEachOutEdge(i): O(deg(i))
+*    forEachInEdge(i): O(indeg(i))
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "ds/graphs.h"
+
+
+inline CSRGraph::CSRGraph(int _n, int _m, const int* sources, const int* targets, const int* weights):
+		n(_n), m(_m) {
+	build(sources, targets, weights);
+}
+
+template <class Graph>
+CSRGraph::CSRGraph(Graph &g): n(g.nVertices()), m(0) {
+	for (int i = 0; i < n; i++){
+		g.forEachOutEdge(i, [&](int, int){ m++; });
+	}
+	Array<int> sources(std::max(m, 1));
+	Array<int> targets(std::max(m, 1));
+	Array<int> weights(std::max(m, 1));
+	int k = 0;
+	for (int i = 0; i < n; i++){
+		g.forEachOutEdge(i, [&](int j, int w){
+			sources[k] = i;
+			targets[k] = j;
+			weights[k] = w;
+			k++;
+		});
+	}
+	build(&sources[0], &targets[0], &weights[0]);
+}
+
+inline void CSRGraph::build(const int* sources, const int* targets, const int* weights){
+	for (int k = 0; k < m; k++){
+		if (sources[k] < 0 || sources[k] >= n || targets[k] < 0 || targets[k] >= n){
+			throw std::out_of_range("vertex is outside the graph");
+		}
+	}
+	outStart = Array<int>(n + 1);
+	outTarget = Array<int>(std::max(m, 1));
+	outWeight = Array<int>(std::max(m, 1));
+	inStart = Array<int>(n + 1);
+	inSource = Array<int>(std::max(m, 1));
+	inWeight = Array<int>(std::max(m, 1));
+
+	// Count the edges into and out of each vertex, then turn the counts into start positions
+	for (int i = 0; i <= n; i++){
+		outStart[i] = 0;
+		inStart[i] = 0;
+	}
+	for (int k = 0; k < m; k++){
+		outStart[sources[k] + 1]++;
+		inStart[targets[k] + 1]++;
+	}
+	for (int i = 0; i < n; i++){
+		outStart[i+1] += outStart[i];
+		inStart[i+1] += inStart[i];
+	}
+
+	// First pass: place the edges by target. inSource temporarily holds edge numbers.
+	Array<int> next(std::max(n, 1));
+	for (int i = 0; i < n; i++){
+		next[i] = inStart[i];
+	}
+	for (int k = 0; k < m; k++){
+		inSource[next[targets[k]]++] = k;
+	}
+
+	// Second pass: take the edges in that order and place them by source
+	for (int i = 0; i < n; i++){
+		next[i] = outStart[i];
+	}
+	for (int p = 0; p < m; p++){
+		int k = inSource[p];
+		int q = next[sources[k]]++;
+		outTarget[q] = targets[k];
+		outWeight[q] = (weights != nullptr) ? weights[k] : 1;
+	}
+
+	// The in-edges, with each group sorted by source
+	for (int i = 0; i < n; i++){
+		next[i] = inStart[i];
+	}
+	for (int i = 0; i < n; i++){
+		for (int q = outStart[i]; q < outStart[i+1]; q++){
+			int p = next[outTarget[q]]++;
+			inSource[p] = i;
+			inWeight[p] = outWeight[q];
+		}
+	}
+}
+
+
+inline int CSRGraph::nVertices(){
+	return n;
+}
+
+inline int CSRGraph::nEdges(){
+	return m;
+}
+
+inline bool CSRGraph::hasEdge(int i, int j){
+	const int* first = outTargets(i);
+	return std::binary_search(first, first + outDegree(i), j);
+}
+
+inline int CSRGraph::outDegree(int i){
+	return outStart[i+1] - outStart[i];
+}
+
+inline const int* CSRGraph::outTargets(int i){
+	return &outTarget[0] + outStart[i];
+}
+
+inline int CSRGraph::inDegree(int i){
+	return inStart[i+1] - inStart[i];
+}
+
+inline const int* CSRGraph::inSources(int i){
+	return &inSource[0] + inStart[i];
+}
+
+template <class F>
+void CSRGraph::forEachOutEdge(int i, F f){
+	const int* t = &outTarget[0];
+	const int* w = &outWeight[0];
+	for (int q = outStart[i], end = outStart[i+1]; q < end; q++){
+		f(t[q], w[q]);
+	}
+}
+
+template <class F>
+void CSRGraph::forEachInEdge(int i, F f){
+	const int* s = &inSource[0];
+	const int* w = &inWeight[0];
+	for (int q = inStart[i], end = inStart[i+1]; q < end; q++){
+		f(s[q], w[q]);
+	}
+}
+
+inline long CSRGraph::bytesUsed(){
+	return 2L * m * sizeof(int);
+}
+
+/**
+* The edges are stored twice, once grouped by source and once by
+* target, so this is a little over twice bytesUsed().
+*/
+inline long CSRGraph::bytesReserved(){
+	long ints = (long)outStart.length() + outTarget.length() + outWeight.length()
+		+ inStart.length() + inSource.length() + inWeight.length();
+	return ints * sizeof(int);
+}
@@ -0,0 +1,162 @@
+/**
+* Direction-optimizing breadth-first search.
+*
+* Each level of the search can be expanded in one of two ways:
+*
+*   top-down:  for every vertex in the frontier, claim each
+*              unvisited out-neighbour for the next level
+*   bottom-up: for every unvisited vertex, look through its
+*              in-neighbours for one that is in the frontier
+*
+* Top-down does work proportional to the edges out of the frontier.
+* Bottom-up does work proportional to the unvisited vertices, but each
+* one stops at the first parent it finds. In graphs with a small
+* diameter the middle levels contain most of the vertices, and there
+* checking from the other side skips most of the edges. Following
+* Beamer et al, the search switches to bottom-up when the edges out of
+* the frontier exceed 1/alpha of the edges still unexplored, and back
+* to top-down when the frontier shrinks below 1/beta of the vertices.
+*
+* Both kinds of step are split into tasks run with forkEach. In a
+* top-down step, two tasks can find the same vertex, so vertices are
+* claimed with a compare-and-swap on their distance, and each task
+* collects its new vertices in its own ArrayStack. In a bottom-up step,
+* each task owns a range of vertices, so no synchronization is needed.
+* The top-down frontier is a list of vertices and the bottom-up
+* frontier one byte per vertex, converted when the direction changes.
+*
+* Performance:
+*
+*   parallelBFS(g, r): O(n + m) work, usually much less in the bottom-up steps
+*/
+
+#include <algorithm>
+#include <atomic>
+
+#include "ds/concurrency.h"
+#include "ds/graphs.h"
+
+
+inline void parallelBFS(CSRGraph &g, int r, int* dist){
+	const long alpha = 14;
+	const long beta = 24;
+	int n = g.nVertices();
+	if (r < 0 || r >= n){
+		throw std::out_of_range("vertex is outside the graph");
+	}
+
+	Array<std::atomic<int> > d(n);
+	for (int i = 0; i < n; i++){
+		d[i].store(-1, std::memory_order_relaxed);
+	}
+	Array<int> listA(n);
+	Array<int> listB(n);
+	Array<char> bitsA(n);
+	Array<char> bitsB(n);
+	int* frontier = &listA[0];
+	int* nextFrontier = &listB[0];
+	char* inFrontier = &bitsA[0];
+	char* inNext = &bitsB[0];
+
+	d[r].store(0, std::memory_order_relaxed);
+	frontier[0] = r;
+	int nf = 1;	// Vertices in the frontier
+	long mf = g.outDegree(r);	// Edges out of the frontier
+	long mu = g.nEdges();	// Edges out of unvisited vertices
+	bool bottomUp = false;
+
+	for (int level = 0; nf > 0; level++){
+		if (!bottomUp && mf > mu / alpha){
+			std::fill(inFrontier, inFrontier + n, 0);
+			for (int k = 0; k < nf; k++){
+				inFrontier[frontier[k]] = 1;
+			}
+			bottomUp = true;
+		} else if (bottomUp && nf < n / beta){
+			nf = 0;
+			for (int i = 0; i < n; i++){
+				if (inFrontier[i]){
+					frontier[nf++] = i;
+				}
+			}
+			bottomUp = false;
+		}
+		mu -= mf;
+
+		if (bottomUp){
+			int tasks = 1 << forkDepth(n);
+			int chunk = (n + tasks - 1) / tasks;
+			Array<int> found(tasks);
+			Array<long> edges(tasks);
+			forkEach(tasks, [&](int t){
+				int lo = std::min(n, t * chunk);
+				int hi = std::min(n, lo + chunk);
+				int count = 0;
+				long out = 0;
+				for (int v = lo; v < hi; v++){
+					inNext[v] = 0;
+					if (d[v].load(std::memory_order_relaxed) != -1){
+						continue;
+					}
+					const int* parents = g.inSources(v);
+					for (int k = 0, deg = g.inDegree(v); k < deg; k++){
+						if (inFrontier[parents[k]]){
+							d[v].store(level + 1, std::memory_order_relaxed);
+							inNext[v] = 1;
+							count++;
+							out += g.outDegree(v);
+							break;
+						}
+					}
+				}
+				found[t] = count;
+				edges[t] = out;
+			});
+			nf = 0;
+			mf = 0;
+			for (int t = 0; t < tasks; t++){
+				nf += found[t];
+				mf += edges[t];
+			}
+			std::swap(inFrontier, inNext);
+		} else {
+			int tasks = 1 << forkDepth(mf);
+			int chunk = (nf + tasks - 1) / tasks;
+			Array<ArrayStack<int> > claimed(tasks);
+			Array<long> edges(tasks);
+			forkEach(tasks, [&](int t){
+				int lo = std::min(nf, t * chunk);
+				int hi = std::min(nf, lo + chunk);
+				ArrayStack<int> &mine = claimed[t];
+				long out = 0;
+				for (int k = lo; k < hi; k++){
+					int u = frontier[k];
+					const int* targets = g.outTargets(u);
+					for (int e = 0, deg = g.outDegree(u); e < deg; e++){
+						int v = targets[e];
+						int unvisited = -1;
+						if (d[v].load(std::memory_order_relaxed) == -1
+								&& d[v].compare_exchange_strong(unvisited, level + 1, std::memory_order_relaxed)){
+							mine.push(v);
+							out += g.outDegree(v);
+						}
+					}
+				}
+				edges[t] = out;
+			});
+			nf = 0;
+			mf = 0;
+			for (int t = 0; t < tasks; t++){
+				for (int k = 0; k < claimed[t].size(); k++){
+					nextFrontier[nf++] = claimed[t].get(k);
+				}
+				mf += edges[t];
+			}
+			std::swap(frontier, nextFrontier);
+		}
+	}
+
+	for (int i = 0; i < n; i++){
+		dist[i] = d[i].load(std::memory_order_relaxed);
+	}
+}
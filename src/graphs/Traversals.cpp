@@ -0,0 +1,117 @@
+/**
+* Graph traversals.
+*
+* Breadth-first search visits the vertices in order of their distance
+* (in edges) from r, using an ArrayQueue of vertices that have been
+* reached but whose edges haven't been followed yet:
+*
+*   r=0, edges 0->1, 0->2, 1->3, 2->3
+*   queue: 0 | 1 2 | 2 3 | 3 |      dist: 0 1 1 2
+*
+* Depth-first search follows edges as far as it can before backing up.
+* Recursion could overflow the call stack on large graphs, so the
+* vertices still to be explored are kept on an ArrayStack instead.
+*
+* Dijkstra's algorithm generalizes breadth-first search to weighted
+* edges: vertices are settled in order of their distance from r, taken
+* from a BinaryHeap of (distance, vertex) pairs. Rather than updating
+* a vertex's entry when a shorter path is found, a new entry is added
+* and the stale one is skipped when it comes out of the heap.
+*
+* All three accept any graph with nVertices() and forEachOutEdge().
+*
+* Performance:
+*
+*        bfs(g, r): O(n + m) with CSRGraph or AdjacencyLists, O(n^2) with AdjacencyMatrix
+*        dfs(g, r): same as bfs
+*   dijkstra(g, r): O((n + m) log(m)), plus the cost of listing the edges
+*/
+
+#include <stdexcept>
+#include <utility>
+
+#include "ds/graphs.h"
+#include "ds/heaps.h"
+
+
+template <class Graph>
+void bfs(Graph &g, int r, int* dist){
+	int n = g.nVertices();
+	if (r < 0 || r >= n){
+		throw std::out_of_range("vertex is outside the graph");
+	}
+	for (int i = 0; i < n; i++){
+		dist[i] = -1;
+	}
+	ArrayQueue<int> q;
+	dist[r] = 0;
+	q.enqueue(r);
+	while (q.size() > 0){
+		int i = q.dequeue();
+		g.forEachOutEdge(i, [&](int j, int){
+			if (dist[j] == -1){
+				dist[j] = dist[i] + 1;
+				q.enqueue(j);
+			}
+		});
+	}
+}
+
+template <class Graph>
+int dfs(Graph &g, int r, int* order){
+	int n = g.nVertices();
+	if (r < 0 || r >= n){
+		throw std::out_of_range("vertex is outside the graph");
+	}
+	Array<char> seen(std::max(n, 1));
+	for (int i = 0; i < n; i++){
+		seen[i] = 0;
+	}
+	ArrayStack<int> s;
+	int visited = 0;
+	s.push(r);
+	while (s.size() > 0){
+		int i = s.pop();
+		if (seen[i]){
+			continue;
+		}
+		seen[i] = 1;
+		order[visited++] = i;
+		g.forEachOutEdge(i, [&](int j, int){
+			if (!seen[j]){
+				s.push(j);
+			}
+		});
+	}
+	return visited;
+}
+
+template <class Graph>
+void dijkstra(Graph &g, int r, long* dist){
+	int n = g.nVertices();
+	if (r < 0 || r >= n){
+		throw std::out_of_range("vertex is outside the graph");
+	}
+	Array<char> settled(std::max(n, 1));
+	for (int i = 0; i < n; i++){
+		dist[i] = -1;
+		settled[i] = 0;
+	}
+	BinaryHeap<std::pair<long, int> > pq;
+	dist[r] = 0;
+	pq.add(std::make_pair(0L, r));
+	while (pq.size() > 0){
+		int i = pq.remove().second;
+		if (settled[i]){
+			continue;	// A shorter path to i was already found
+		}
+		settled[i] = 1;
+		g.forEachOutEdge(i, [&](int j, int w){
+			long d = dist[i] + w;
+			if (!settled[j] && (dist[j] == -1 || d < dist[j])){
+				dist[j] = d;
+				pq.add(std::make_pair(d, j));
+			}
+		});
+	}
+}
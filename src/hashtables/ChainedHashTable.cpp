@@ -0,0 +1,144 @@
+/**
+* Hash table using chaining.
+*
+* Elements are stored in an array of lists. The hash function maps each
+* element to one of the lists, so only that list needs to be searched
+* to find the element:
+*
+*   t[0]: 12 4
+*   t[1]:
+*   t[2]: 9
+*   t[3]: 7 3 15
+*
+* The array is kept at least as long as the number of elements, so
+* with a good hash function each list holds O(1) elements on average.
+*
+* Multiplicative hashing: with t.length() = 2^d, an element's list is
+* the top d bits of the (32 bit) product of its hash code and a random
+* odd number z. Multiplying mixes the low bits of the hash code into
+* the high bits, so this works even with std::hash<int>, which is the
+* identity.
+*
+* Performance (expected):
+*
+*      add(x): O(1), amortized over resizes
+*   remove(x): O(1)
+*     find(x): O(1)
+*/
+
+#include <functional>
+#include <stdexcept>
+#include <stdlib.h>
+#include <utility>
+
+#include "ds/hash_tables.h"
+
+
+template <class T>
+ChainedHashTable<T>::ChainedHashTable(): t(2){
+	z = rand() | 1;
+}
+
+template <class T>
+unsigned ChainedHashTable<T>::hash(const T& x){
+	return ((unsigned)(z * std::hash<T>()(x))) >> (32 - d);
+}
+
+/**
+* Make t.length() the smallest power of 2 greater than n,
+* and move every element to its list in the new array. Each is moved
+* out with set(), leaving a default T behind in the old list.
+*/
+template <class T>
+void ChainedHashTable<T>::resize(){
+	d = 1;
+	while ((1 << d) <= n){
+		d++;
+	}
+	Array<ArrayStack<T> > newT(1 << d);
+	for (int i = 0; i < t.length(); i++){
+		for (int j = 0; j < t[i].size(); j++){
+			T x = t[i].set(j, T());
+			unsigned h = hash(x);
+			newT[h].push(std::move(x));
+		}
+	}
+	t = std::move(newT);
+}
+
+
+template <class T>
+int ChainedHashTable<T>::size(){
+	return n;
+}
+
+template <class T>
+bool ChainedHashTable<T>::add(T x){
+	if (contains(x)){
+		return false;
+	}
+	if (n+1 > t.length()){
+		resize();
+	}
+	unsigned h = hash(x);
+	t[h].push(std::move(x));
+	n++;
+	return true;
+}
+
+template <class T>
+T ChainedHashTable<T>::remove(T x){
+	ArrayStack<T> &list = t[hash(x)];
+	for (int i = 0; i < list.size(); i++){
+		if (list.get(i) == x){
+			// Move the last element into its place so the removal doesn't shift the list
+			T y = list.pop();
+			if (i < list.size()){
+				y = list.set(i, std::move(y));
+			}
+			n--;
+			return y;
+		}
+	}
+	throw std::out_of_range("Could not find x for removal");
+}
+
+template <class T>
+T ChainedHashTable<T>::find(const T& x){
+	ArrayStack<T> &list = t[hash(x)];
+	for (int i = 0; i < list.size(); i++){
+		if (list.get(i) == x){
+			return list.get(i);
+		}
+	}
+	throw std::out_of_range("Could not find x");
+}
+
+template <class T>
+bool ChainedHashTable<T>::contains(const T& x){
+	ArrayStack<T> &list = t[hash(x)];
+	for (int i = 0; i < list.size(); i++){
+		if (list.get(i) == x){
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/**
+* Adds up the buckets, so takes time proportional to the table size.
+*/
+template <class T>
+long ChainedHashTable<T>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T>
+long ChainedHashTable<T>::bytesReserved(){
+	long reserved = (long)t.length() * sizeof(ArrayStack<T>);
+	for (int i = 0; i < t.length(); i++){
+		reserved += t[i].bytesReserved();
+	}
+	return reserved;
+}
@@ -0,0 +1,153 @@
+/**
+* Hash table using linear probing.
+*
+* Elements are stored directly in the array t. An element x is stored
+* at t[hash(x)] if that slot is free, otherwise at the next free slot
+* after it (wrapping around at the end of the array). Searching for x
+* starts at t[hash(x)] and stops at the first empty slot.
+*
+* Removing an element can't simply empty its slot, as that would cut
+* short the search for elements stored after it. The slot is marked
+* as deleted instead: searches skip over it, and add() may reuse it.
+* Deleted slots are only cleared when the table is resized, which
+* happens when the full and deleted slots (q) fill half the array.
+*
+* The state of each slot is kept in a separate array, rather than
+* reserving special values of T for empty and deleted slots.
+*
+* Performance (expected):
+*
+*      add(x): O(1), amortized over resizes
+*   remove(x): O(1), amortized over resizes
+*     find(x): O(1)
+*/
+
+#include <functional>
+#include <stdexcept>
+#include <stdlib.h>
+#include <utility>
+
+#include "ds/hash_tables.h"
+
+
+template <class T>
+LinearHashTable<T>::LinearHashTable(): t(2), state(2){
+	z = rand() | 1;
+	state[0] = empty;
+	state[1] = empty;
+}
+
+template <class T>
+unsigned LinearHashTable<T>::hash(const T& x){
+	return ((unsigned)(z * std::hash<T>()(x))) >> (32 - d);
+}
+
+/**
+* Make t.length() the smallest power of 2 that is at least 3n,
+* and re-add every element, dropping the deleted markers.
+*/
+template <class T>
+void LinearHashTable<T>::resize(){
+	d = 1;
+	while ((1 << d) < 3*n){
+		d++;
+	}
+	Array<T> newT(1 << d);
+	Array<char> newState(1 << d);
+	for (int i = 0; i < newState.length(); i++){
+		newState[i] = empty;
+	}
+	for (int k = 0; k < t.length(); k++){
+		if (state[k] == full){
+			int i = hash(t[k]);
+			while (newState[i] != empty){
+				i = (i == newT.length()-1) ? 0 : i+1;
+			}
+			newT[i] = std::move(t[k]);
+			newState[i] = full;
+		}
+	}
+	q = n;
+	t = std::move(newT);
+	state = std::move(newState);
+}
+
+
+template <class T>
+int LinearHashTable<T>::size(){
+	return n;
+}
+
+template <class T>
+bool LinearHashTable<T>::add(T x){
+	if (contains(x)){
+		return false;
+	}
+	if (2*(q+1) > t.length()){
+		resize();
+	}
+	int i = hash(x);
+	while (state[i] == full){
+		i = (i == t.length()-1) ? 0 : i+1;
+	}
+	if (state[i] == empty){
+		q++;
+	}
+	n++;
+	t[i] = std::move(x);
+	state[i] = full;
+	return true;
+}
+
+template <class T>
+T LinearHashTable<T>::remove(T x){
+	int i = hash(x);
+	while (state[i] != empty){
+		if (state[i] == full && t[i] == x){
+			T y = std::move(t[i]);
+			state[i] = deleted;
+			n--;
+			if (8*n < t.length()){
+				resize();
+			}
+			return y;
+		}
+		i = (i == t.length()-1) ? 0 : i+1;
+	}
+	throw std::out_of_range("Could not find x for removal");
+}
+
+template <class T>
+T LinearHashTable<T>::find(const T& x){
+	int i = hash(x);
+	while (state[i] != empty){
+		if (state[i] == full && t[i] == x){
+			return t[i];
+		}
+		i = (i == t.length()-1) ? 0 : i+1;
+	}
+	throw std::out_of_range("Could not find x");
+}
+
+template <class T>
+bool LinearHashTable<T>::contains(const T& x){
+	int i = hash(x);
+	while (state[i] != empty){
+		if (state[i] == full && t[i] == x){
+			return true;
+		}
+		i = (i == t.length()-1) ? 0 : i+1;
+	}
+	return false;
+}
+
+
+template <class T>
+long LinearHashTable<T>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T>
+long LinearHashTable<T>::bytesReserved(){
+	return (long)t.length() * (sizeof(T) + sizeof(char));
+}
@@ -0,0 +1,66 @@
+/**
+* Key-value map on top of SwissTable. See SwissTable.cpp for details.
+*/
+
+#include <stdexcept>
+#include <utility>
+
+#include "ds/hash_tables.h"
+
+
+template <class K, class V>
+int SwissHashMap<K, V>::size(){
+	return table.size();
+}
+
+/**
+* Adds k, or replaces its value if it is already present.
+*/
+template <class K, class V>
+bool SwissHashMap<K, V>::put(K k, V v){
+	bool added;
+	table.insert(std::move(k), added)->value = std::move(v);
+	return added;
+}
+
+template <class K, class V>
+V SwissHashMap<K, V>::get(K k){
+	MapEntry<K, V>* e = table.lookup(k);
+	if (e == nullptr){
+		throw std::out_of_range("Could not find key");
+	}
+	return e->value;
+}
+
+template <class K, class V>
+V* SwissHashMap<K, V>::lookup(K k){
+	MapEntry<K, V>* e = table.lookup(k);
+	return (e == nullptr) ? nullptr : &e->value;
+}
+
+template <class K, class V>
+bool SwissHashMap<K, V>::contains(K k){
+	return table.lookup(k) != nullptr;
+}
+
+template <class K, class V>
+V SwissHashMap<K, V>::remove(K k){
+	MapEntry<K, V>* e = table.lookup(k);
+	if (e == nullptr){
+		throw std::out_of_range("Could not find key for removal");
+	}
+	V v = std::move(e->value);
+	table.erase(k);
+	return v;
+}
+
+
+template <class K, class V>
+long SwissHashMap<K, V>::bytesUsed(){
+	return (long)table.size() * (sizeof(K) + sizeof(V));
+}
+
+template <class K, class V>
+long SwissHashMap<K, V>::bytesReserved(){
+	return table.bytesReserved();
+}
@@ -0,0 +1,57 @@
+/**
+* Unordered set on top of SwissTable. See SwissTable.cpp for details.
+*
+* contains(x) is the cheapest way to test membership, since find(x)
+* and remove(x) report a missing element by throwing.
+*/
+
+#include <stdexcept>
+#include <utility>
+
+#include "ds/hash_tables.h"
+
+
+template <class T>
+int SwissHashSet<T>::size(){
+	return table.size();
+}
+
+template <class T>
+bool SwissHashSet<T>::add(T x){
+	bool added;
+	table.insert(std::move(x), added);
+	return added;
+}
+
+template <class T>
+T SwissHashSet<T>::remove(T x){
+	if (!table.erase(x)){
+		throw std::out_of_range("Could not find x for removal");
+	}
+	return x;
+}
+
+template <class T>
+T SwissHashSet<T>::find(const T& x){
+	SetEntry<T>* e = table.lookup(x);
+	if (e == nullptr){
+		throw std::out_of_range("Could not find x");
+	}
+	return e->key;
+}
+
+template <class T>
+bool SwissHashSet<T>::contains(const T& x){
+	return table.lookup(x) != nullptr;
+}
+
+
+template <class T>
+long SwissHashSet<T>::bytesUsed(){
+	return (long)table.size() * sizeof(T);
+}
+
+template <class T>
+long SwissHashSet<T>::bytesReserved(){
+	return table.bytesReserved();
+}
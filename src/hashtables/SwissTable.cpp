@@ -0,0 +1,320 @@
+/**
+* Open addressing hash table in the style of Swiss tables.
+*
+* Alongside the array of slots is an array of control bytes, one per
+* slot. A control byte is either empty (0x80) or, for a full slot, the
+* low 7 bits of the hash of its key (h2). The rest of the hash (h1)
+* picks the slot where probing starts.
+*
+*   ctrl:  80 80 3a 11 80 80 80 6c ...  80 | 80 80 3a 11 ...
+*   slots:  _  _  k  k  _  _  _  k  ...   _ |
+*                                            ^ copies of the first 15 bytes
+*
+* Probing is linear, but looks at 16 control bytes at once. With SSE2
+* a single compare turns them into a bitmask of the slots whose h2
+* matches, and another into a bitmask of the empty slots. Only slots
+* that match (1 in 128 of the others, by chance) have their keys
+* compared, and the probe ends at the first empty slot. Copying the
+* first bytes after the end lets a 16 byte load start at any slot
+* without checking for wrap-around.
+*
+* Removal is tombstone free. Because probing is linear and every key
+* is found before the first empty slot after its home, removing a key
+* can shift later keys back into the gap (backward shift deletion)
+* instead of leaving a deleted marker. The table never fills up with
+* markers, so it never needs rehashing just to clear them.
+*
+* Resizing is incremental. When the table reaches 7/8 full a table of
+* twice the size is allocated, and every add() and remove() moves the
+* next few slots of the old table across. Until the old table is empty
+* lookups check both tables. A slot that has been moved (or removed)
+* from the old table is marked 'moved', which probes treat as full but
+* never matching; the old table is freed as soon as it's drained, so
+* these markers don't accumulate. No single operation pays for copying
+* the whole table.
+*
+* Performance (expected):
+*
+*      insert: O(1)
+*       erase: O(1)
+*      lookup: O(1), usually one 16 byte load and one key comparison
+*/
+
+#include <functional>
+#include <utility>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "ds/hash_tables.h"
+
+
+/**
+* std::hash is often the identity for integers, so the hash code is
+* multiplied by a large odd constant to spread its bits out.
+*/
+template <class K, class E>
+size_t SwissTable<K, E>::hash(const K &k){
+	unsigned long long h = std::hash<K>()(k);
+	h *= 0x9E3779B97F4A7C15ull;
+	return (size_t)(h ^ (h >> 32));
+}
+
+/**
+* Bit i of the result is set if group[i] == b.
+*/
+template <class K, class E>
+unsigned SwissTable<K, E>::match(const unsigned char* group, unsigned char b){
+#ifdef __SSE2__
+	__m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)b)));
+#else
+	unsigned mask = 0;
+	for (int i = 0; i < groupWidth; i++){
+		if (group[i] == b){
+			mask |= 1u << i;
+		}
+	}
+	return mask;
+#endif
+}
+
+template <class K, class E>
+typename SwissTable<K, E>::Table SwissTable<K, E>::allocate(int cap){
+	Table tb;
+	tb.cap = cap;
+	tb.ctrl = new unsigned char[cap + groupWidth - 1];
+	for (int i = 0; i < cap + groupWidth - 1; i++){
+		tb.ctrl[i] = empty;
+	}
+	tb.slots = new E[cap];
+	return tb;
+}
+
+template <class K, class E>
+void SwissTable<K, E>::release(Table &tb){
+	delete[] tb.ctrl;
+	delete[] tb.slots;
+	tb.ctrl = nullptr;
+	tb.slots = nullptr;
+}
+
+/**
+* Keeps the copies of the first control bytes up to date.
+*/
+template <class K, class E>
+void SwissTable<K, E>::setCtrl(Table &tb, int i, unsigned char c){
+	tb.ctrl[i] = c;
+	if (i < groupWidth - 1){
+		tb.ctrl[tb.cap + i] = c;
+	}
+}
+
+/**
+* Returns the entry holding k, setting index to its slot,
+* or nullptr if k is not in tb.
+*/
+template <class K, class E>
+E* SwissTable<K, E>::probe(Table &tb, const K &k, size_t h, int &index){
+	int mask = tb.cap - 1;
+	int i = (int)(h >> 7) & mask;
+	unsigned char h2 = h & 0x7F;
+	while (true){
+		unsigned matches = match(tb.ctrl + i, h2);
+		unsigned empties = match(tb.ctrl + i, empty);
+		if (empties){
+			// k can't be stored after the first empty slot
+			matches &= (empties & (0u - empties)) - 1;
+		}
+		while (matches){
+			int j = (i + __builtin_ctz(matches)) & mask;
+			if (tb.slots[j].key == k){
+				index = j;
+				return &tb.slots[j];
+			}
+			matches &= matches - 1;
+		}
+		if (empties){
+			return nullptr;
+		}
+		i = (i + groupWidth) & mask;
+	}
+}
+
+template <class K, class E>
+int SwissTable<K, E>::emptySlot(Table &tb, size_t h){
+	int mask = tb.cap - 1;
+	int i = (int)(h >> 7) & mask;
+	while (true){
+		unsigned empties = match(tb.ctrl + i, empty);
+		if (empties){
+			return (i + __builtin_ctz(empties)) & mask;
+		}
+		i = (i + groupWidth) & mask;
+	}
+}
+
+
+template <class K, class E>
+SwissTable<K, E>::SwissTable(){
+	t = allocate(groupWidth);
+	old.ctrl = nullptr;
+	old.slots = nullptr;
+	old.cap = 0;
+}
+
+template <class K, class E>
+SwissTable<K, E>::~SwissTable(){
+	release(t);
+	if (old.ctrl != nullptr){
+		release(old);
+	}
+}
+
+
+template <class K, class E>
+int SwissTable<K, E>::size(){
+	return n;
+}
+
+template <class K, class E>
+E* SwissTable<K, E>::lookup(const K &k){
+	size_t h = hash(k);
+	int index;
+	E* e = probe(t, k, h, index);
+	if (e == nullptr && old.ctrl != nullptr){
+		e = probe(old, k, h, index);
+	}
+	return e;
+}
+
+/**
+* Returns the entry for k, adding one (with a default constructed
+* value) if k was not present. added reports which happened.
+*/
+template <class K, class E>
+E* SwissTable<K, E>::insert(K &&k, bool &added){
+	migrateStep();
+	E* e = lookup(k);
+	if (e != nullptr){
+		added = false;
+		return e;
+	}
+
+	if (8*(tn+1) > 7*t.cap){
+		grow();
+	}
+	size_t h = hash(k);
+	int i = emptySlot(t, h);
+	setCtrl(t, i, h & 0x7F);
+	t.slots[i] = E();
+	t.slots[i].key = std::move(k);
+	tn++;
+	n++;
+	added = true;
+	return &t.slots[i];
+}
+
+template <class K, class E>
+bool SwissTable<K, E>::erase(const K &k){
+	migrateStep();
+	size_t h = hash(k);
+	int index;
+	if (probe(t, k, h, index) != nullptr){
+		backwardShift(index);
+		tn--;
+		n--;
+		return true;
+	}
+	if (old.ctrl != nullptr && probe(old, k, h, index) != nullptr){
+		setCtrl(old, index, moved);
+		old.slots[index] = E();	// Release anything the entry owns now
+		n--;
+		return true;
+	}
+	return false;
+}
+
+
+/**
+* Start moving everything to a table twice the size. If the previous
+* resize hasn't finished, finish it first.
+*/
+template <class K, class E>
+void SwissTable<K, E>::grow(){
+	while (old.ctrl != nullptr){
+		migrateStep();
+	}
+	old = t;
+	t = allocate(2 * old.cap);
+	tn = 0;
+	migrated = 0;
+}
+
+/**
+* Move up to migrateBatch slots from the old table. The old table
+* starts at most 7/8 full and the new one has twice the space, so
+* moving 32 slots per operation drains it long before the new table
+* needs to grow.
+*/
+template <class K, class E>
+void SwissTable<K, E>::migrateStep(){
+	if (old.ctrl == nullptr){
+		return;
+	}
+	int end = migrated + migrateBatch;
+	if (end > old.cap){
+		end = old.cap;
+	}
+	for (; migrated < end; migrated++){
+		if (old.ctrl[migrated] < empty){
+			size_t h = hash(old.slots[migrated].key);
+			int i = emptySlot(t, h);
+			setCtrl(t, i, h & 0x7F);
+			t.slots[i] = std::move(old.slots[migrated]);
+			tn++;
+			setCtrl(old, migrated, moved);
+		}
+	}
+	if (migrated == old.cap){
+		release(old);
+	}
+}
+
+/**
+* Empty slot i of t, then walk forward through the run of full slots
+* after it. Any entry whose home slot is not between the gap and its
+* current slot could be found from the gap, so it moves back into the
+* gap, and its old slot becomes the new gap.
+*/
+template <class K, class E>
+void SwissTable<K, E>::backwardShift(int i){
+	int mask = t.cap - 1;
+	int j = i;
+	while (true){
+		j = (j + 1) & mask;
+		if (t.ctrl[j] == empty){
+			break;
+		}
+		int home = (int)(hash(t.slots[j].key) >> 7) & mask;
+		// Does home lie cyclically in (i, j]? Then the entry must stay
+		bool stays = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+		if (!stays){
+			t.slots[i] = std::move(t.slots[j]);
+			setCtrl(t, i, t.ctrl[j]);
+			i = j;
+		}
+	}
+	setCtrl(t, i, empty);
+	t.slots[i] = E();
+}
+
+
+template <class K, class E>
+long SwissTable<K, E>::bytesReserved(){
+	long reserved = (long)(t.cap + groupWidth - 1) + (long)t.cap * sizeof(E);
+	if (old.ctrl != nullptr){
+		reserved += (long)(old.cap + groupWidth - 1) + (long)old.cap * sizeof(E);
+	}
+	return reserved;
+}
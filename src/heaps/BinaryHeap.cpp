@@ -0,0 +1,209 @@
+/**
+* Implicit heap stored in an array.
+*
+* The elements form a complete tree in which every node is no larger
+* than its children, so the smallest element is always at the root.
+* The tree is stored level by level, so no pointers are needed: the
+* children of the node at index i are at indices D*i+1, ..., D*i+D,
+* and its parent is at (i-1)/D.
+*
+* With D=2 this is the BinaryHeap of Open Data Structures. A larger D
+* gives a shallower tree, so add() does fewer comparisons, while
+* remove() compares more children per level but visits fewer levels.
+* Each level of remove() reads D siblings that are next to each other
+* in memory. The first D-1 slots of the array are left unused, which
+* makes every group of siblings start at a multiple of D, so for small
+* types (eg 4 ints in 16 bytes) a group never straddles two cache lines.
+*
+*   D = 4, offset 3:  _ _ _ | r | c c c c | c c c c | c c c c | ...
+*                             0   1 ... 4   5 ... 8   9 ... 12
+*
+* Elements are moved into place by shifting rather than swapping: the
+* moving element is held aside and written once at its final position.
+*
+* Performance:
+*
+*         add(x): O(log_D(n)), amortized over resizes
+*       remove(): O(D log_D(n)), amortized over resizes
+*         peek(): O(1)
+*   addAll(xs,m): O(n+m) when rebuilding, O(m log_D(n+m)) otherwise
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "ds/heaps.h"
+
+
+/**
+* Make room for length elements. As in ArrayStack, doubling when full
+* and shrinking by the ShrinkPolicy keeps resizing O(1) amortized.
+*/
+template <class T, int D>
+void BinaryHeap<T, D>::resize(int length){
+	Array<T> b(offset + length);
+	if (n > 0){
+		std::move(&a[0] + offset, &a[0] + offset + n, &b[0] + offset);
+	}
+	a = std::move(b);
+}
+
+/**
+* Move the element at i up until its parent is no larger.
+*/
+template <class T, int D>
+void BinaryHeap<T, D>::bubbleUp(T* h, int i){
+	T x = std::move(h[i]);
+	while (i > 0){
+		int p = (i-1) / D;
+		if (!(x < h[p])){
+			break;
+		}
+		h[i] = std::move(h[p]);
+		i = p;
+	}
+	h[i] = std::move(x);
+}
+
+/**
+* Move the element at i down until none of its children is smaller.
+*/
+template <class T, int D>
+void BinaryHeap<T, D>::trickleDown(T* h, int i){
+	T x = std::move(h[i]);
+	while (true){
+		int first = D*i + 1;
+		if (first >= n){
+			break;
+		}
+		int last = std::min(first + D, n);
+		int smallest = first;
+		for (int c = first + 1; c < last; c++){
+			if (h[c] < h[smallest]){
+				smallest = c;
+			}
+		}
+		if (!(h[smallest] < x)){
+			break;
+		}
+		h[i] = std::move(h[smallest]);
+		i = smallest;
+	}
+	h[i] = std::move(x);
+}
+
+
+template <class T, int D>
+int BinaryHeap<T, D>::size(){
+	return n;
+}
+
+template <class T, int D>
+void BinaryHeap<T, D>::add(T x){
+	if (offset + n + 1 > a.length()){
+		resize(2*(n+1));
+	}
+	T* h = &a[0] + offset;
+	h[n] = std::move(x);
+	n++;
+	bubbleUp(h, n-1);
+}
+
+template <class T, int D>
+T BinaryHeap<T, D>::remove(){
+	if (n == 0){
+		throw std::out_of_range("heap is empty");
+	}
+	T* h = &a[0] + offset;
+	T x = std::move(h[0]);
+	h[0] = std::move(h[n-1]);
+	n--;
+	if (n > 0){
+		trickleDown(h, 0);
+	}
+	if (policy.shrinks(a.length() - offset, n)){
+		resize(policy.shrunkLength(n));
+	}
+	return x;
+}
+
+template <class T, int D>
+T BinaryHeap<T, D>::peek(){
+	if (n == 0){
+		throw std::out_of_range("heap is empty");
+	}
+	return a[offset];
+}
+
+/**
+* Add m elements at once. If that at least doubles the heap, it's
+* cheaper to rebuild the whole heap bottom up (Floyd's method, O(n)
+* in total) than to bubble each new element up.
+*/
+template <class T, int D>
+void BinaryHeap<T, D>::addAll(const T* xs, int m){
+	if (m <= 0){
+		return;
+	}
+	if (offset + n + m > a.length()){
+		resize(2*(n+m));
+	}
+	T* h = &a[0] + offset;
+	std::copy(xs, xs + m, h + n);
+	if (m >= n){
+		n += m;
+		for (int i = (n-2) / D; i >= 0; i--){
+			trickleDown(h, i);
+		}
+	} else {
+		for (int k = 0; k < m; k++){
+			n++;
+			bubbleUp(h, n-1);
+		}
+	}
+}
+
+
+template <class T, int D>
+int BinaryHeap<T, D>::capacity(){
+	return a.length() - offset;
+}
+
+template <class T, int D>
+void BinaryHeap<T, D>::reserve(int m){
+	if (m > capacity()){
+		resize(m);
+	}
+}
+
+template <class T, int D>
+void BinaryHeap<T, D>::shrinkToFit(){
+	if (capacity() > std::max(n, 1)){
+		resize(std::max(n, 1));
+	}
+}
+
+template <class T, int D>
+ShrinkPolicy BinaryHeap<T, D>::shrinkPolicy(){
+	return policy;
+}
+
+template <class T, int D>
+void BinaryHeap<T, D>::setShrinkPolicy(ShrinkPolicy p){
+	policy = p;
+}
+
+
+/**
+* Includes the D-1 unused slots at the front.
+*/
+template <class T, int D>
+long BinaryHeap<T, D>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T, int D>
+long BinaryHeap<T, D>::bytesReserved(){
+	return (long)a.length() * sizeof(T);
+}
@@ -0,0 +1,130 @@
+/**
+* Randomized meldable heap.
+*
+* A heap-ordered binary tree with no constraint on its shape. Everything
+* is done with merge(h1, h2), which combines two heaps: the root with
+* the smaller value becomes the root of the result, and the other heap
+* is merged (recursively) into one of its subtrees, chosen at random.
+*
+*   add(x):   merge the heap with a one node heap holding x
+*   remove(): merge the two subtrees of the root
+*   meld(b):  merge the two heaps
+*
+* Because the subtree is chosen by a coin toss, the expected length of
+* the random path that merge walks down is O(log(n)), whatever the
+* order of the operations. Unlike the array based BinaryHeap, two heaps
+* can be combined without copying either one.
+*
+* The nodes are BTNodes, as used by the binary search trees.
+*
+* Performance (expected):
+*
+*     add(x): O(log(n))
+*   remove(): O(log(n))
+*     peek(): O(1)
+*    meld(b): O(log(n) + log(b.size()))
+*/
+
+#include <stdexcept>
+#include <stdlib.h>
+#include <utility>
+
+#include "ds/heaps.h"
+
+
+template <class T>
+MeldableHeap<T>::~MeldableHeap(){
+	while (root != nullptr){
+		BTNode<T>* u = root;
+		root = merge(u->left, u->right);
+		delete u;
+	}
+}
+
+template <class T>
+BTNode<T>* MeldableHeap<T>::merge(BTNode<T>* h1, BTNode<T>* h2){
+	if (h1 == nullptr){
+		return h2;
+	}
+	if (h2 == nullptr){
+		return h1;
+	}
+	if (h2->x < h1->x){
+		std::swap(h1, h2);
+	}
+	// Now h1->x is the smallest value, so h1 is the new root
+	if (rand() % 2){
+		h1->left = merge(h1->left, h2);
+		h1->left->parent = h1;
+	} else {
+		h1->right = merge(h1->right, h2);
+		h1->right->parent = h1;
+	}
+	return h1;
+}
+
+
+template <class T>
+int MeldableHeap<T>::size(){
+	return n;
+}
+
+template <class T>
+void MeldableHeap<T>::add(T x){
+	BTNode<T>* u = new BTNode<T>(std::move(x));
+	root = merge(u, root);
+	root->parent = nullptr;
+	n++;
+}
+
+template <class T>
+T MeldableHeap<T>::remove(){
+	if (root == nullptr){
+		throw std::out_of_range("heap is empty");
+	}
+	T x = std::move(root->x);
+	BTNode<T>* u = root;
+	root = merge(root->left, root->right);
+	delete u;
+	if (root != nullptr){
+		root->parent = nullptr;
+	}
+	n--;
+	return x;
+}
+
+template <class T>
+T MeldableHeap<T>::peek(){
+	if (root == nullptr){
+		throw std::out_of_range("heap is empty");
+	}
+	return root->x;
+}
+
+/**
+* Moves every element of b into this heap, leaving b empty.
+*/
+template <class T>
+void MeldableHeap<T>::meld(MeldableHeap<T> &b){
+	if (&b == this){
+		return;
+	}
+	root = merge(root, b.root);
+	if (root != nullptr){
+		root->parent = nullptr;
+	}
+	n += b.n;
+	b.root = nullptr;
+	b.n = 0;
+}
+
+
+template <class T>
+long MeldableHeap<T>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T>
+long MeldableHeap<T>::bytesReserved(){
+	return (long)n * sizeof(BTNode<T>);
+}
@@ -0,0 +1,146 @@
+/**
+* Counters for instrumented containers, and the registry that totals
+* them.
+*
+* Counting is a plain increment on the container's own Counters, with
+* no locking or atomics, so instrumented containers are no less thread
+* safe than before and only a little slower. The registry's lock is
+* only taken when an instrumented container is created or destroyed,
+* and when the totals are read.
+*
+* The registry keeps a linked list of the live counters, and when one
+* is destroyed its counts are added to a running total for its name.
+* totals() combines the two:
+*
+*   live:     ArrayStack{resizes: 3} -> ArrayStack{resizes: 1} -> Treap{rotations: 9}
+*   retired:  ArrayStack{instances: 5, resizes: 20}
+*
+*   totals(): ArrayStack{instances: 7, live: 2, resizes: 24}
+*             Treap{instances: 1, live: 1, rotations: 9}
+*
+* toJSON() writes the same thing as one object per container name:
+*
+*   {
+*     "ArrayStack": {"instances": 7, "live": 2, "resizes": 24, ...},
+*     "Treap": {"instances": 1, "live": 1, "rotations": 9, ...}
+*   }
+*/
+
+#include <cstring>
+#include <sstream>
+
+#include "ds/instrument.h"
+
+
+inline OpStats& OpStats::operator+=(const OpStats &b){
+	resizes += b.resizes;
+	copies += b.copies;
+	shifts += b.shifts;
+	balances += b.balances;
+	rotations += b.rotations;
+	steps += b.steps;
+	return *this;
+}
+
+
+inline Counters<true>::Counters(const char* _name): name(_name) {
+	InstrumentRegistry::instance().add(this);
+}
+
+inline Counters<true>::Counters(const Counters<true> &b): name(b.name) {
+	InstrumentRegistry::instance().add(this);
+}
+
+inline Counters<true>::~Counters(){
+	InstrumentRegistry::instance().remove(this);
+}
+
+
+inline InstrumentRegistry& InstrumentRegistry::instance(){
+	static InstrumentRegistry registry;
+	return registry;
+}
+
+/**
+* The entry in totals for name, added if there isn't one. There are
+* only ever a handful of names, so a linear search is fine.
+*/
+inline InstrumentRegistry::Totals& InstrumentRegistry::find(std::vector<Totals> &totals, const char* name){
+	for (size_t i = 0; i < totals.size(); i++){
+		if (std::strcmp(totals[i].name, name) == 0){
+			return totals[i];
+		}
+	}
+	Totals t = {name, 0, 0, OpStats()};
+	totals.push_back(t);
+	return totals.back();
+}
+
+inline void InstrumentRegistry::add(Counters<true>* c){
+	std::lock_guard<std::mutex> guard(lock);
+	c->prev = nullptr;
+	c->next = live;
+	if (live != nullptr){
+		live->prev = c;
+	}
+	live = c;
+	find(retired, c->name).instances++;
+}
+
+inline void InstrumentRegistry::remove(Counters<true>* c){
+	std::lock_guard<std::mutex> guard(lock);
+	if (c->prev != nullptr){
+		c->prev->next = c->next;
+	} else {
+		live = c->next;
+	}
+	if (c->next != nullptr){
+		c->next->prev = c->prev;
+	}
+	find(retired, c->name).stats += c->s;
+}
+
+inline std::vector<InstrumentRegistry::Totals> InstrumentRegistry::totals(){
+	std::lock_guard<std::mutex> guard(lock);
+	std::vector<Totals> result = retired;
+	for (Counters<true>* c = live; c != nullptr; c = c->next){
+		Totals &t = find(result, c->name);
+		t.live++;
+		t.stats += c->s;
+	}
+	return result;
+}
+
+inline std::string InstrumentRegistry::toJSON(){
+	std::vector<Totals> t = totals();
+	std::ostringstream ss;
+	ss << "{";
+	for (size_t i = 0; i < t.size(); i++){
+		const OpStats &s = t[i].stats;
+		ss << (i == 0 ? "\n" : ",\n")
+			<< "  \"" << t[i].name << "\": {"
+			<< "\"instances\": " << t[i].instances
+			<< ", \"live\": " << t[i].live
+			<< ", \"resizes\": " << s.resizes
+			<< ", \"copies\": " << s.copies
+			<< ", \"shifts\": " << s.shifts
+			<< ", \"balances\": " << s.balances
+			<< ", \"rotations\": " << s.rotations
+			<< ", \"steps\": " << s.steps << "}";
+	}
+	ss << "\n}";
+	return ss.str();
+}
+
+/**
+* Zeroes every count, including those of the live containers, and
+* forgets the containers that have been destroyed.
+*/
+inline void InstrumentRegistry::reset(){
+	std::lock_guard<std::mutex> guard(lock);
+	retired.clear();
+	for (Counters<true>* c = live; c != nullptr; c = c->next){
+		c->s = OpStats();
+		find(retired, c->name).instances++;
+	}
+}
@@ -24,14 +24,33 @@
 * removeFirst(): O(1)
 *    addLast(x): O(1)
 * removeLast(x): O(1)
+*
+* Callers that keep hold of node handles (eg a cache with a hash index
+* into the list) can insert, move and remove nodes anywhere in O(1):
+*
+*   addBefore(w,x): O(1)
+* moveBefore(u,w): O(1)
+*  removeNode(u): O(1)
 */
 
+#include <utility>
+
 template <class T>
-DLList<T>::DLList(): dummy(DNode<T>(0)){
+DLList<T>::DLList(): Counters<Instrumented<DLList<T> >::value>("DLList"), dummy(T()){
 	dummy.next = &dummy;
 	dummy.prev = &dummy;
 }
 
+template <class T>
+DLList<T>::~DLList(){
+	DNode<T>* u = dummy.next;
+	while (u != &dummy){
+		DNode<T>* w = u->next;
+		delete u;
+		u = w;
+	}
+}
+
 
 template <class T>
 DNode<T>* DLList<T>::getNode(int i){
@@ -44,19 +63,21 @@ DNode<T>* DLList<T>::getNode(int i){
 		for (int j=0; j < i; j++){
 			p = p->next;
 		}
+		this->stepped(i);
 	} else {
 		// Start at the tail and work backward
 		p = &dummy;
 		for (int j=n; j > i; j--){
 			p = p->prev;
 		}
+		this->stepped(n - i);
 	}
 	return p;
 }
 
 template <class T>
 DNode<T>* DLList<T>::addBefore(DNode<T> *w, T x){
-	DNode<T>* u = new DNode<T>(x);
+	DNode<T>* u = new DNode<T>(std::move(x));
 	u->prev = w->prev;
 	u->next = w;
 	u->next->prev = u;	// Same as w->prev = u
@@ -72,7 +93,7 @@ int DLList<T>::size(){
 }
 
 template <class T>
-T DLList<T>::get(int i){
+const T& DLList<T>::get(int i){
 	return getNode(i)->x;
 }
 
@@ -80,33 +101,25 @@ T DLList<T>::get(int i){
 template <class T>
 T DLList<T>::set(int i, T x){
 	DNode<T>* u = getNode(i);
-	T old = u->x;
-	u->x = x;
+	T old = std::move(u->x);
+	u->x = std::move(x);
 	return old;
 }
 
 template <class T>
 void DLList<T>::add(int i, T x){
-	addBefore(getNode(i), x);
+	addBefore(getNode(i), std::move(x));
 }
 
 template <class T>
 T DLList<T>::remove(int i){
-	DNode<T>* w = getNode(i);
-	T x = w->x;
-
-	w->prev->next = w->next;
-	w->next->prev = w->prev;
-	delete w;
-	n--;
-
-	return x;
+	return removeNode(getNode(i));
 }
 
 
 template <class T>
 void DLList<T>::addFirst(T x){
-	add(0, x);
+	add(0, std::move(x));
 }
 
 template <class T>
@@ -116,7 +129,7 @@ T DLList<T>::removeFirst(){
 
 template <class T>
 void DLList<T>::addLast(T x){
-	add(n, x);
+	add(n, std::move(x));
 }
 
 template <class T>
@@ -127,7 +140,7 @@ T DLList<T>::removeLast(){
 
 template <class T>
 void DLList<T>::push(T x){
-	addFirst(x);
+	addFirst(std::move(x));
 }
 
 template <class T>
@@ -138,10 +151,64 @@ T DLList<T>::pop(){
 
 template <class T>
 void DLList<T>::enqueue(T x){
-	addFirst(x);
+	addFirst(std::move(x));
 }
 
 template <class T>
 T DLList<T>::dequeue(){
 	return removeLast();
 }
+
+
+template <class T>
+DNode<T>* DLList<T>::end(){
+	return &dummy;
+}
+
+/**
+* Unlink u and put it back in just before w. Nothing is allocated.
+*/
+template <class T>
+void DLList<T>::moveBefore(DNode<T> *u, DNode<T> *w){
+	if (u == w || u->next == w){
+		return;
+	}
+	u->prev->next = u->next;
+	u->next->prev = u->prev;
+	u->prev = w->prev;
+	u->next = w;
+	w->prev->next = u;
+	w->prev = u;
+}
+
+template <class T>
+T DLList<T>::removeNode(DNode<T> *u){
+	T x = std::move(u->x);
+
+	u->prev->next = u->next;
+	u->next->prev = u->prev;
+	delete u;
+	n--;
+
+	return x;
+}
+
+
+template <class T>
+OpStats DLList<T>::stats(){
+	return this->counts();
+}
+
+
+/**
+* The dummy node is part of the list object, so isn't counted.
+*/
+template <class T>
+long DLList<T>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T>
+long DLList<T>::bytesReserved(){
+	return (long)n * sizeof(DNode<T>);
+}
@@ -31,9 +31,20 @@
 */
 
 #include <stdexcept>
+#include <utility>
 
 #include "ds/linked_lists.h"
 
+template <class T>
+SLList<T>::~SLList(){
+	Node<T>* u = head;
+	for (int i = 0; i < n; i++){
+		Node<T>* next = u->next;
+		delete u;
+		u = next;
+	}
+}
+
 template <class T>
 int SLList<T>::size(){
 	return n;
@@ -41,7 +52,7 @@ int SLList<T>::size(){
 
 template <class T>
 void SLList<T>::push(T x){
-	Node<T>* u = new Node<T>(x);
+	Node<T>* u = new Node<T>(std::move(x));
 	u->next = head;
 	head = u;
 	if (n == 0){
@@ -56,7 +67,7 @@ T SLList<T>::pop(){
 		throw std::out_of_range("list is empty");
 	}
 
-	T x = head->x;
+	T x = std::move(head->x);
 	Node<T>* u = head;
 	head = head->next;
 	delete u;
@@ -73,7 +84,7 @@ T SLList<T>::pop(){
 */
 template <class T>
 void SLList<T>::enqueue(T x){
-	Node<T>* u = new Node<T>(x);
+	Node<T>* u = new Node<T>(std::move(x));
 	if (n == 0){
 		head = u;
 	} else {
@@ -88,3 +99,14 @@ template <class T>
 T SLList<T>::dequeue(){
 	return pop();
 }
+
+
+template <class T>
+long SLList<T>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+template <class T>
+long SLList<T>::bytesReserved(){
+	return (long)n * sizeof(Node<T>);
+}
@@ -0,0 +1,217 @@
+/**
+* Array stored in a memory-mapped file.
+*
+* The file is mapped shared and read-write, so element accesses are
+* ordinary loads and stores, and the kernel moves pages between the
+* page cache and the disk as they are needed. Only the pages that are
+* touched take up memory, and clean ones can be dropped under memory
+* pressure, so the array can be much larger than RAM.
+*
+* Resizing doesn't copy anything. The file is extended (or cut) with
+* ftruncate, and mremap moves the mapping to a larger range of
+* addresses if it can't grow in place, taking the same pages with it.
+* Extending a file leaves a hole, so capacity that is never written
+* takes no disk space.
+*
+*   [header][x0][x1] ... [x(n-1)][    hole    ]
+*                                 ^ used()     ^ length()
+*
+* Performance:
+*
+*   operator[](i): O(1), plus a page fault the first time a page is touched
+*      resize(l):  O(1) copying, whatever the length
+*        sync():   O(dirty pages)
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ds/mapped_arrays.h"
+
+
+template <class T>
+size_t MappedArray<T>::fileBytes(long len){
+	return sizeof(SnapshotHeader) + (size_t)len * sizeof(T);
+}
+
+/**
+* A new file gets an empty list header. An existing one must be a
+* list snapshot of T, and is only ever extended to len.
+*/
+template <class T>
+MappedArray<T>::MappedArray(const char* path, long len) {
+	static_assert(std::is_trivially_copyable<T>::value, "mapped arrays store elements as raw bytes");
+	static_assert(alignof(T) <= sizeof(SnapshotHeader), "elements would be misaligned after the header");
+	hint = MADV_NORMAL;
+	len = std::max(len, 1L);
+
+	fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0){
+		throw std::runtime_error(std::string("could not open ") + path + ": " + std::strerror(errno));
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0){
+		close(fd);
+		throw std::runtime_error(std::string("could not stat ") + path);
+	}
+	bool created = st.st_size == 0;
+	size_t bytes = created ? fileBytes(len) : st.st_size;
+	if (created && ftruncate(fd, bytes) != 0){
+		close(fd);
+		throw std::runtime_error(std::string("could not extend ") + path + ": " + std::strerror(errno));
+	}
+	void* m = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (m == MAP_FAILED){
+		close(fd);
+		throw std::runtime_error(std::string("could not map ") + path + ": " + std::strerror(errno));
+	}
+	p = static_cast<char*>(m);
+
+	if (created){
+		SnapshotHeader h = snapshotHeader(contiguousLayout, sizeof(T), 0);
+		std::memcpy(p, &h, sizeof(h));
+	} else {
+		try {
+			checkSnapshot(p, bytes, contiguousLayout, sizeof(T), 0);
+		} catch(std::runtime_error&){
+			munmap(p, bytes);
+			close(fd);
+			throw;
+		}
+	}
+	l = (bytes - sizeof(SnapshotHeader)) / sizeof(T);	// Exact, checkSnapshot rejects partial elements
+	if (l < len){
+		try {
+			resize(len);
+		} catch(std::runtime_error&){
+			munmap(p, bytes);
+			close(fd);
+			throw;
+		}
+	}
+}
+
+/**
+* Unmapping doesn't lose anything: dirty pages stay in the page cache
+* and are written back by the kernel. Call sync() first to wait for that.
+*/
+template <class T>
+MappedArray<T>::~MappedArray() {
+	munmap(p, fileBytes(l));
+	close(fd);
+}
+
+template <class T>
+T& MappedArray<T>::operator[](long i) {
+	if (i >= 0 && i < l){
+		return data()[i];
+	} else {
+		throw std::out_of_range("index is outside array bounds");
+	}
+}
+
+template <class T>
+T* MappedArray<T>::data(){
+	return reinterpret_cast<T*>(p + sizeof(SnapshotHeader));
+}
+
+template <class T>
+long MappedArray<T>::length(){
+	return l;
+}
+
+/**
+* The file must be long enough before the mapping grows, and the
+* mapping must shrink before the file does, or a page of the mapping
+* would have nothing behind it.
+*/
+template <class T>
+void MappedArray<T>::resize(long len){
+	len = std::max(len, 1L);
+	size_t oldBytes = fileBytes(l);
+	size_t newBytes = fileBytes(len);
+	if (newBytes > oldBytes && ftruncate(fd, newBytes) != 0){
+		throw std::runtime_error(std::string("could not extend mapped file: ") + std::strerror(errno));
+	}
+	void* m = mremap(p, oldBytes, newBytes, MREMAP_MAYMOVE);
+	if (m == MAP_FAILED){
+		throw std::runtime_error(std::string("could not remap file: ") + std::strerror(errno));
+	}
+	p = static_cast<char*>(m);
+	l = len;
+	if (newBytes < oldBytes && ftruncate(fd, newBytes) != 0){
+		throw std::runtime_error(std::string("could not shrink mapped file: ") + std::strerror(errno));
+	}
+	advise(hint);
+}
+
+
+template <class T>
+long MappedArray<T>::used(){
+	return (long)reinterpret_cast<SnapshotHeader*>(p)->n;
+}
+
+template <class T>
+void MappedArray<T>::setUsed(long n){
+	reinterpret_cast<SnapshotHeader*>(p)->n = n;
+}
+
+
+template <class T>
+void MappedArray<T>::advise(int advice){
+	hint = advice;
+	madvise(p, fileBytes(l), advice);	// Only a hint, so failure is harmless
+}
+
+template <class T>
+void MappedArray<T>::adviseNormal(){
+	advise(MADV_NORMAL);
+}
+
+/**
+* Read ahead aggressively, and free pages soon after they are read.
+* Suits scanning a log from one end to the other.
+*/
+template <class T>
+void MappedArray<T>::adviseSequential(){
+	advise(MADV_SEQUENTIAL);
+}
+
+/**
+* Don't read ahead, since neighbouring pages are unlikely to be next.
+* Suits binary searches and hash probes over a large array.
+*/
+template <class T>
+void MappedArray<T>::adviseRandom(){
+	advise(MADV_RANDOM);
+}
+
+/**
+* madvise needs a page aligned address, so the range is widened to
+* start at the beginning of i's page.
+*/
+template <class T>
+void MappedArray<T>::willNeed(long i, long j){
+	if (i < 0 || j > l || i > j){
+		throw std::out_of_range("range is outside array bounds");
+	}
+	size_t page = sysconf(_SC_PAGESIZE);
+	size_t start = fileBytes(i) - fileBytes(i) % page;
+	madvise(p + start, fileBytes(j) - start, MADV_WILLNEED);
+}
+
+template <class T>
+void MappedArray<T>::sync(){
+	if (msync(p, fileBytes(l), MS_SYNC) != 0){
+		throw std::runtime_error(std::string("could not sync mapped file: ") + std::strerror(errno));
+	}
+}
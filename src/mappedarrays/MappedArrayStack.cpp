@@ -0,0 +1,155 @@
+/**
+* ArrayStack backed by a memory-mapped file.
+*
+* Works like ArrayStack, but the array is a MappedArray, so resizing
+* changes the length of the file instead of copying the elements, and
+* the size is kept in the file's header. Reopening the file gives back
+* the same list, which makes this a good fit for append-only logs:
+*
+*   MappedArrayStack<Event> log("events.log");
+*   log.push(e);
+*
+* Shifting is done with memmove, since the elements are trivially
+* copyable.
+*
+* Performance:
+*
+*      get(i): O(1)
+*    set(i,x): O(1)
+*    add(i,x): O(n-i), and O(1) copying when the file has to grow
+*   remove(i): O(n-i)
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "ds/mapped_arrays.h"
+
+
+template <class T>
+MappedArrayStack<T>::MappedArrayStack(const char* path): a(path) {
+	n = a.used();
+}
+
+template <class T>
+long MappedArrayStack<T>::size(){
+	return n;
+}
+
+template <class T>
+T MappedArrayStack<T>::get(long i){
+	if (i < 0 || i >= n){
+		throw std::out_of_range("index is outside the list");
+	}
+	return a[i];
+}
+
+template <class T>
+T MappedArrayStack<T>::set(long i, T x){
+	if (i < 0 || i >= n){
+		throw std::out_of_range("index is outside the list");
+	}
+	T y = a[i];
+	a[i] = x;
+	return y;
+}
+
+template <class T>
+void MappedArrayStack<T>::add(long i, T x){
+	if (i < 0 || i > n){
+		throw std::out_of_range("index is outside the list");
+	}
+	if (n+1 > a.length()) a.resize(std::max(2*n, 1L));
+	T* b = a.data();
+	std::memmove(b + i + 1, b + i, (n - i) * sizeof(T));
+	b[i] = x;
+	n++;
+	a.setUsed(n);
+}
+
+template <class T>
+T MappedArrayStack<T>::remove(long i){
+	if (i < 0 || i >= n){
+		throw std::out_of_range("index is outside the list");
+	}
+	T* b = a.data();
+	T x = b[i];
+	std::memmove(b + i, b + i + 1, (n - i - 1) * sizeof(T));
+	n--;
+	a.setUsed(n);
+	if (policy.shrinks(a.length(), n)) a.resize(policy.shrunkLength(n));
+	return x;
+}
+
+template <class T>
+void MappedArrayStack<T>::push(T x){
+	add(n, x);
+}
+
+template <class T>
+T MappedArrayStack<T>::pop(){
+	return remove(n-1);
+}
+
+
+/**
+* Same policy as ArrayStack: twice the size when full, and shrink by
+* the ShrinkPolicy. Extending the file only makes a hole, so the slack
+* costs address space, not disk.
+*/
+template <class T>
+long MappedArrayStack<T>::capacity(){
+	return a.length();
+}
+
+template <class T>
+void MappedArrayStack<T>::reserve(long m){
+	if (m > a.length()) a.resize(m);
+}
+
+template <class T>
+void MappedArrayStack<T>::shrinkToFit(){
+	if (a.length() > std::max(n, 1L)) a.resize(std::max(n, 1L));
+}
+
+template <class T>
+ShrinkPolicy MappedArrayStack<T>::shrinkPolicy(){
+	return policy;
+}
+
+template <class T>
+void MappedArrayStack<T>::setShrinkPolicy(ShrinkPolicy p){
+	policy = p;
+}
+
+
+template <class T>
+void MappedArrayStack<T>::adviseSequential(){
+	a.adviseSequential();
+}
+
+template <class T>
+void MappedArrayStack<T>::adviseRandom(){
+	a.adviseRandom();
+}
+
+template <class T>
+void MappedArrayStack<T>::sync(){
+	a.sync();
+}
+
+
+/**
+* Reserved counts the whole file, though the hole past n takes no
+* disk space until it is written.
+*/
+template <class T>
+long MappedArrayStack<T>::bytesUsed(){
+	return n * sizeof(T);
+}
+
+template <class T>
+long MappedArrayStack<T>::bytesReserved(){
+	return a.length() * sizeof(T);
+}
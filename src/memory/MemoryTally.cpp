@@ -0,0 +1,136 @@
+/**
+* Process-wide allocation tally.
+*
+* With DS_TRACK_ALLOCATIONS defined, every operator new allocates 16
+* extra bytes in front of the block and stores the requested size
+* there, so operator delete knows how much is being freed:
+*
+*   malloc'd:  [ size | pad ][ the caller's bytes ... ]
+*                            ^ returned by operator new
+*
+* 16 bytes keeps the block aligned for any fundamental type. The tally
+* counts the bytes that were asked for, not the allocator's own
+* overhead, and includes everything allocated with new, not just the
+* containers.
+*
+* The replacement operators can't be inline, so only one translation
+* unit may define DS_TRACK_ALLOCATIONS.
+*/
+
+#include <cstdlib>
+
+#include "ds/memory.h"
+
+
+inline MemoryTally& MemoryTally::instance(){
+	static MemoryTally tally;	// Constant initialized, so safe to use from operator new
+	return tally;
+}
+
+inline void MemoryTally::allocate(size_t bytes){
+	long now = current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+	long top = highest.load(std::memory_order_relaxed);
+	while (now > top && !highest.compare_exchange_weak(top, now, std::memory_order_relaxed)) {}
+	allocated.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void MemoryTally::release(size_t bytes){
+	current.fetch_sub(bytes, std::memory_order_relaxed);
+	freed.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline bool MemoryTally::tracking(){
+	return allocated.load() > 0;
+}
+
+inline long MemoryTally::bytes(){
+	return current.load();
+}
+
+inline long MemoryTally::peak(){
+	return highest.load();
+}
+
+inline long MemoryTally::allocations(){
+	return allocated.load();
+}
+
+inline long MemoryTally::frees(){
+	return freed.load();
+}
+
+inline void MemoryTally::resetPeak(){
+	highest.store(current.load());
+}
+
+
+#ifdef DS_TRACK_ALLOCATIONS
+
+static const size_t trackingHeader = 16;
+
+static void* trackedAllocate(size_t size){
+	void* p = std::malloc(size + trackingHeader);
+	if (p == nullptr){
+		return nullptr;
+	}
+	*static_cast<size_t*>(p) = size;
+	MemoryTally::instance().allocate(size);
+	return static_cast<char*>(p) + trackingHeader;
+}
+
+static void trackedRelease(void* p){
+	if (p == nullptr){
+		return;
+	}
+	void* block = static_cast<char*>(p) - trackingHeader;
+	MemoryTally::instance().release(*static_cast<size_t*>(block));
+	std::free(block);
+}
+
+void* operator new(size_t size){
+	void* p = trackedAllocate(size);
+	if (p == nullptr){
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void* operator new[](size_t size){
+	return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+	return trackedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+	return trackedAllocate(size);
+}
+
+void operator delete(void* p) noexcept {
+	trackedRelease(p);
+}
+
+void operator delete[](void* p) noexcept {
+	trackedRelease(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+	trackedRelease(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+	trackedRelease(p);
+}
+
+#if __cpp_sized_deallocation
+void operator delete(void* p, size_t) noexcept {
+	trackedRelease(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+	trackedRelease(p);
+}
+#endif
+
+#endif
@@ -0,0 +1,187 @@
+/**
+* Chunked parallel algorithms.
+*
+* The range is split into 1 << forkDepth(n) chunks, so every core gets
+* a few (see ForkJoin.cpp), and each chunk is handled by one task:
+*
+*   a:  |  chunk 0  |  chunk 1  |  chunk 2  |  chunk 3  |
+*                   ^ cut moved forward to the next cache line
+*
+* A cut is moved forward from its even position until the elements on
+* either side of it are on different cache lines. Tasks that write to
+* their chunk (transform, scan) then never write to the same line as
+* a neighbour, so the line isn't passed back and forth between cores
+* (false sharing). Chunks can come out a few elements uneven, or empty
+* if the range is shorter than a few lines.
+*
+* reduce works out the result of each chunk in parallel, then combines
+* them in order on the calling thread. inclusiveScan makes two passes:
+*
+*   1. reduce each chunk to its total, in parallel
+*   2. on the calling thread, turn the totals into the carry into each
+*      chunk, ie the total of everything before it
+*   3. scan each chunk in parallel, starting from its carry
+*
+* so each element is read twice and written once. All of these are
+* usually limited by memory bandwidth rather than by the cores.
+*
+* Performance:
+*
+*          forEach, transform: O(n) work, O(n/p) time on p cores
+*                      reduce: O(n) work, O(n/p + p) time
+*               inclusiveScan: O(2n) work, O(n/p + p) time
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "ds/parallel.h"
+
+
+/**
+* Whether a[i-1] and a[i] are on different cache lines, ie the line
+* holding the last byte of the lower of the two isn't the one the
+* higher starts on. It isn't always a[i-1] that is lower, eg with a
+* std::reverse_iterator.
+*/
+template <class It>
+bool onLineBoundary(It a, int i){
+	const std::uintptr_t cacheLine = 64;
+	std::uintptr_t x = reinterpret_cast<std::uintptr_t>(std::addressof(a[i-1]));
+	std::uintptr_t y = reinterpret_cast<std::uintptr_t>(std::addressof(a[i]));
+	std::uintptr_t lowEnd = std::min(x, y) + sizeof(a[i]) - 1;
+	return lowEnd / cacheLine != std::max(x, y) / cacheLine;
+}
+
+/**
+* tasks+1 cut positions, from 0 to n, so that chunk k is
+* a[bounds[k]..bounds[k+1]-1].
+*/
+template <class It>
+std::vector<int> chunkBounds(It a, int n, int tasks){
+	std::vector<int> bounds(tasks + 1);
+	bounds[0] = 0;
+	for (int k = 1; k < tasks; k++){
+		int b = (int)((long)k * n / tasks);
+		if (b < bounds[k-1]){
+			b = bounds[k-1];
+		}
+		while (b > 0 && b < n && !onLineBoundary(a, b)){
+			b++;
+		}
+		bounds[k] = b;
+	}
+	bounds[tasks] = n;
+	return bounds;
+}
+
+
+template <class It, class F>
+void parallelForEach(It a, int n, F f){
+	int tasks = 1 << forkDepth(n);
+	std::vector<int> bounds = chunkBounds(a, n, tasks);
+	forkEach(tasks, [&](int t){
+		for (int i = bounds[t]; i < bounds[t+1]; i++){
+			f(a[i]);
+		}
+	});
+}
+
+template <class It, class F>
+void parallelTransform(It a, int n, F f){
+	parallelForEach(a, n, [&](decltype(a[0]) x){
+		x = f(x);
+	});
+}
+
+
+/**
+* The result of one chunk, if it wasn't empty.
+*/
+template <class T>
+struct ChunkResult {
+	T value;
+	bool empty = true;
+};
+
+template <class It, class T, class Op>
+std::vector<ChunkResult<T> > reduceChunks(It a, const std::vector<int> &bounds, Op op){
+	int tasks = bounds.size() - 1;
+	std::vector<ChunkResult<T> > results(tasks);
+	forkEach(tasks, [&](int t){
+		int lo = bounds[t];
+		int hi = bounds[t+1];
+		if (lo < hi){
+			T r = a[lo];
+			for (int i = lo + 1; i < hi; i++){
+				r = op(r, a[i]);
+			}
+			results[t].value = r;
+			results[t].empty = false;
+		}
+	});
+	return results;
+}
+
+template <class It, class T, class Op>
+T parallelReduce(It a, int n, T init, Op op){
+	int tasks = 1 << forkDepth(n);
+	std::vector<int> bounds = chunkBounds(a, n, tasks);
+	std::vector<ChunkResult<T> > results = reduceChunks<It, T>(a, bounds, op);
+	for (int t = 0; t < tasks; t++){
+		if (!results[t].empty){
+			init = op(init, results[t].value);
+		}
+	}
+	return init;
+}
+
+
+/**
+* carry, if it isn't empty, is combined into the first element.
+*/
+template <class It, class Element, class Op>
+void scanWithCarry(It a, int n, Op op, ChunkResult<Element> carry){
+	int tasks = 1 << forkDepth(n);
+	std::vector<int> bounds = chunkBounds(a, n, tasks);
+	std::vector<ChunkResult<Element> > totals = reduceChunks<It, Element>(a, bounds, op);
+
+	std::vector<ChunkResult<Element> > carries(tasks);
+	for (int t = 0; t < tasks; t++){
+		carries[t] = carry;
+		if (!totals[t].empty){
+			carry.value = carry.empty ? totals[t].value : op(carry.value, totals[t].value);
+			carry.empty = false;
+		}
+	}
+
+	forkEach(tasks, [&](int t){
+		int lo = bounds[t];
+		int hi = bounds[t+1];
+		if (lo < hi){
+			if (!carries[t].empty){
+				a[lo] = op(carries[t].value, a[lo]);
+			}
+			for (int i = lo + 1; i < hi; i++){
+				a[i] = op(a[i-1], a[i]);
+			}
+		}
+	});
+}
+
+template <class It, class Op>
+void parallelInclusiveScan(It a, int n, Op op){
+	typedef typename std::remove_reference<decltype(a[0])>::type Element;
+	scanWithCarry(a, n, op, ChunkResult<Element>());
+}
+
+template <class It, class T, class Op>
+void parallelInclusiveScan(It a, int n, Op op, T init){
+	typedef typename std::remove_reference<decltype(a[0])>::type Element;
+	ChunkResult<Element> carry;
+	carry.value = init;
+	carry.empty = false;
+	scanWithCarry(a, n, op, carry);
+}
@@ -0,0 +1,93 @@
+/**
+* Scans one element at a time.
+*
+* These are the fallback for types without a SIMD version. They take
+* a plain pointer, so the loops have no virtual calls or bounds checks,
+* and the compiler is free to vectorize the ones without an early exit
+* (count, min, max and integer sums) by itself.
+*
+* Performance:
+*
+*   scanIndexOf(a, n, x): O(i), where i is the index found
+*     scanCount(a, n, x): O(n)
+*  scanMin/Max/Sum(a, n): O(n)
+*/
+
+#include "ds/scans.h"
+
+
+template <class T>
+int scalarIndexOf(const T* a, int n, const T& x){
+	for (int i = 0; i < n; i++){
+		if (a[i] == x){
+			return i;
+		}
+	}
+	return -1;
+}
+
+template <class T>
+int scalarCount(const T* a, int n, const T& x){
+	int c = 0;
+	for (int i = 0; i < n; i++){
+		c += (a[i] == x);
+	}
+	return c;
+}
+
+template <class T>
+T scalarMin(const T* a, int n){
+	T m = a[0];
+	for (int i = 1; i < n; i++){
+		if (a[i] < m){
+			m = a[i];
+		}
+	}
+	return m;
+}
+
+template <class T>
+T scalarMax(const T* a, int n){
+	T m = a[0];
+	for (int i = 1; i < n; i++){
+		if (m < a[i]){
+			m = a[i];
+		}
+	}
+	return m;
+}
+
+template <class T>
+typename ScanSum<T>::type scalarSum(const T* a, int n){
+	typename ScanSum<T>::type s = typename ScanSum<T>::type();
+	for (int i = 0; i < n; i++){
+		s += a[i];
+	}
+	return s;
+}
+
+
+template <class T>
+int scanIndexOf(const T* a, int n, const T& x){
+	return scalarIndexOf(a, n, x);
+}
+
+template <class T>
+int scanCount(const T* a, int n, const T& x){
+	return scalarCount(a, n, x);
+}
+
+template <class T>
+T scanMin(const T* a, int n){
+	return scalarMin(a, n);
+}
+
+template <class T>
+T scanMax(const T* a, int n){
+	return scalarMax(a, n);
+}
+
+template <class T>
+typename ScanSum<T>::type scanSum(const T* a, int n){
+	return scalarSum(a, n);
+}
@@ -0,0 +1,280 @@
+/**
+* SIMD scans for int and double.
+*
+* Each loop compares or combines a whole vector of elements at a time,
+* 8 ints or 4 doubles with AVX2, 4 ints or 2 doubles with SSE2:
+*
+*   a:       7 3 9 3 | 1 4 3 8   ...
+*   x:       3 3 3 3 | 3 3 3 3
+*   a == x:  0 1 0 1 | 0 0 1 0   -> bitmask 0x4a, first match at ctz = 1
+*
+* indexOf tests four vectors per iteration and only works out which
+* element matched once one of them does. count subtracts the compare
+* results (-1 for a match) from a vector of running counts. min and
+* max keep one running value per lane, and int sums are widened to 64
+* bits before they're added. The lanes are combined at the end, and
+* whatever is left over after the last full vector goes through the
+* scalar versions in Scans.cpp.
+*
+* Which version is compiled depends on the target: AVX2 if __AVX2__
+* is defined, otherwise SSE2 (always there on x86-64). min and max of
+* ints need SSE4.1 for their 128 bit versions; without it, and on
+* other architectures, these fall back to the scalar loops.
+*
+* double min and max stay scalar, since the SIMD instructions treat
+* NaN differently from <. double sums add the lanes separately, so
+* the result can differ from a left to right sum in the last bits.
+*/
+
+#include <algorithm>
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+
+#include "ds/scans.h"
+
+
+template <>
+inline int scanIndexOf<int>(const int* a, int n, const int& x){
+	int i = 0;
+#if defined(__AVX2__)
+	__m256i v = _mm256_set1_epi32(x);
+	for (; i + 32 <= n; i += 32){
+		__m256i e0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i)), v);
+		__m256i e1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 8)), v);
+		__m256i e2 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 16)), v);
+		__m256i e3 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i + 24)), v);
+		__m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+		if (!_mm256_testz_si256(any, any)){
+			unsigned m = _mm256_movemask_ps(_mm256_castsi256_ps(e0))
+				| _mm256_movemask_ps(_mm256_castsi256_ps(e1)) << 8
+				| _mm256_movemask_ps(_mm256_castsi256_ps(e2)) << 16
+				| (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(e3)) << 24;
+			return i + __builtin_ctz(m);
+		}
+	}
+	for (; i + 8 <= n; i += 8){
+		__m256i e = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i)), v);
+		int m = _mm256_movemask_ps(_mm256_castsi256_ps(e));
+		if (m != 0){
+			return i + __builtin_ctz(m);
+		}
+	}
+#elif defined(__SSE2__)
+	__m128i v = _mm_set1_epi32(x);
+	for (; i + 16 <= n; i += 16){
+		__m128i e0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)), v);
+		__m128i e1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 4)), v);
+		__m128i e2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 8)), v);
+		__m128i e3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i + 12)), v);
+		__m128i any = _mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3));
+		if (_mm_movemask_epi8(any) != 0){
+			unsigned m = _mm_movemask_ps(_mm_castsi128_ps(e0))
+				| _mm_movemask_ps(_mm_castsi128_ps(e1)) << 4
+				| _mm_movemask_ps(_mm_castsi128_ps(e2)) << 8
+				| _mm_movemask_ps(_mm_castsi128_ps(e3)) << 12;
+			return i + __builtin_ctz(m);
+		}
+	}
+	for (; i + 4 <= n; i += 4){
+		__m128i e = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)), v);
+		int m = _mm_movemask_ps(_mm_castsi128_ps(e));
+		if (m != 0){
+			return i + __builtin_ctz(m);
+		}
+	}
+#endif
+	int j = scalarIndexOf(a + i, n - i, x);
+	return (j < 0) ? -1 : i + j;
+}
+
+template <>
+inline int scanCount<int>(const int* a, int n, const int& x){
+	int i = 0;
+	int c = 0;
+#if defined(__AVX2__)
+	__m256i v = _mm256_set1_epi32(x);
+	__m256i counts = _mm256_setzero_si256();
+	for (; i + 8 <= n; i += 8){
+		counts = _mm256_sub_epi32(counts, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i)), v));
+	}
+	int lanes[8];
+	_mm256_storeu_si256((__m256i*)lanes, counts);
+	c = scalarSum(lanes, 8);
+#elif defined(__SSE2__)
+	__m128i v = _mm_set1_epi32(x);
+	__m128i counts = _mm_setzero_si128();
+	for (; i + 4 <= n; i += 4){
+		counts = _mm_sub_epi32(counts, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)), v));
+	}
+	int lanes[4];
+	_mm_storeu_si128((__m128i*)lanes, counts);
+	c = scalarSum(lanes, 4);
+#endif
+	return c + scalarCount(a + i, n - i, x);
+}
+
+template <>
+inline int scanMin<int>(const int* a, int n){
+#if defined(__AVX2__)
+	if (n >= 8){
+		__m256i m = _mm256_loadu_si256((const __m256i*)a);
+		int i = 8;
+		for (; i + 8 <= n; i += 8){
+			m = _mm256_min_epi32(m, _mm256_loadu_si256((const __m256i*)(a + i)));
+		}
+		int lanes[8];
+		_mm256_storeu_si256((__m256i*)lanes, m);
+		int lowest = scalarMin(lanes, 8);
+		return (i < n) ? std::min(lowest, scalarMin(a + i, n - i)) : lowest;
+	}
+#elif defined(__SSE4_1__)
+	if (n >= 4){
+		__m128i m = _mm_loadu_si128((const __m128i*)a);
+		int i = 4;
+		for (; i + 4 <= n; i += 4){
+			m = _mm_min_epi32(m, _mm_loadu_si128((const __m128i*)(a + i)));
+		}
+		int lanes[4];
+		_mm_storeu_si128((__m128i*)lanes, m);
+		int lowest = scalarMin(lanes, 4);
+		return (i < n) ? std::min(lowest, scalarMin(a + i, n - i)) : lowest;
+	}
+#endif
+	return scalarMin(a, n);
+}
+
+template <>
+inline int scanMax<int>(const int* a, int n){
+#if defined(__AVX2__)
+	if (n >= 8){
+		__m256i m = _mm256_loadu_si256((const __m256i*)a);
+		int i = 8;
+		for (; i + 8 <= n; i += 8){
+			m = _mm256_max_epi32(m, _mm256_loadu_si256((const __m256i*)(a + i)));
+		}
+		int lanes[8];
+		_mm256_storeu_si256((__m256i*)lanes, m);
+		int highest = scalarMax(lanes, 8);
+		return (i < n) ? std::max(highest, scalarMax(a + i, n - i)) : highest;
+	}
+#elif defined(__SSE4_1__)
+	if (n >= 4){
+		__m128i m = _mm_loadu_si128((const __m128i*)a);
+		int i = 4;
+		for (; i + 4 <= n; i += 4){
+			m = _mm_max_epi32(m, _mm_loadu_si128((const __m128i*)(a + i)));
+		}
+		int lanes[4];
+		_mm_storeu_si128((__m128i*)lanes, m);
+		int highest = scalarMax(lanes, 4);
+		return (i < n) ? std::max(highest, scalarMax(a + i, n - i)) : highest;
+	}
+#endif
+	return scalarMax(a, n);
+}
+
+template <>
+inline long scanSum<int>(const int* a, int n){
+	int i = 0;
+	long s = 0;
+#if defined(__AVX2__)
+	__m256i sums = _mm256_setzero_si256();
+	for (; i + 8 <= n; i += 8){
+		sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(a + i))));
+		sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(a + i + 4))));
+	}
+	long long lanes[4];
+	_mm256_storeu_si256((__m256i*)lanes, sums);
+	s = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__SSE2__)
+	__m128i sums = _mm_setzero_si128();
+	for (; i + 4 <= n; i += 4){
+		__m128i v = _mm_loadu_si128((const __m128i*)(a + i));
+		__m128i sign = _mm_srai_epi32(v, 31);
+		sums = _mm_add_epi64(sums, _mm_unpacklo_epi32(v, sign));
+		sums = _mm_add_epi64(sums, _mm_unpackhi_epi32(v, sign));
+	}
+	long long lanes[2];
+	_mm_storeu_si128((__m128i*)lanes, sums);
+	s = lanes[0] + lanes[1];
+#endif
+	return s + scalarSum(a + i, n - i);
+}
+
+
+template <>
+inline int scanIndexOf<double>(const double* a, int n, const double& x){
+	int i = 0;
+#if defined(__AVX2__)
+	__m256d v = _mm256_set1_pd(x);
+	for (; i + 16 <= n; i += 16){
+		unsigned m = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(a + i), v, _CMP_EQ_OQ))
+			| _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(a + i + 4), v, _CMP_EQ_OQ)) << 4
+			| _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(a + i + 8), v, _CMP_EQ_OQ)) << 8
+			| _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(a + i + 12), v, _CMP_EQ_OQ)) << 12;
+		if (m != 0){
+			return i + __builtin_ctz(m);
+		}
+	}
+#elif defined(__SSE2__)
+	__m128d v = _mm_set1_pd(x);
+	for (; i + 8 <= n; i += 8){
+		unsigned m = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i), v))
+			| _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i + 2), v)) << 2
+			| _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i + 4), v)) << 4
+			| _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i + 6), v)) << 6;
+		if (m != 0){
+			return i + __builtin_ctz(m);
+		}
+	}
+#endif
+	int j = scalarIndexOf(a + i, n - i, x);
+	return (j < 0) ? -1 : i + j;
+}
+
+template <>
+inline int scanCount<double>(const double* a, int n, const double& x){
+	int i = 0;
+	int c = 0;
+#if defined(__AVX2__)
+	__m256d v = _mm256_set1_pd(x);
+	for (; i + 4 <= n; i += 4){
+		c += __builtin_popcount(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(a + i), v, _CMP_EQ_OQ)));
+	}
+#elif defined(__SSE2__)
+	__m128d v = _mm_set1_pd(x);
+	for (; i + 2 <= n; i += 2){
+		c += __builtin_popcount(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i), v)));
+	}
+#endif
+	return c + scalarCount(a + i, n - i, x);
+}
+
+template <>
+inline double scanSum<double>(const double* a, int n){
+	int i = 0;
+	double s = 0;
+#if defined(__AVX2__)
+	__m256d s0 = _mm256_setzero_pd();
+	__m256d s1 = _mm256_setzero_pd();
+	for (; i + 8 <= n; i += 8){
+		s0 = _mm256_add_pd(s0, _mm256_loadu_pd(a + i));
+		s1 = _mm256_add_pd(s1, _mm256_loadu_pd(a + i + 4));
+	}
+	double lanes[4];
+	_mm256_storeu_pd(lanes, _mm256_add_pd(s0, s1));
+	s = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(__SSE2__)
+	__m128d s0 = _mm_setzero_pd();
+	__m128d s1 = _mm_setzero_pd();
+	for (; i + 4 <= n; i += 4){
+		s0 = _mm_add_pd(s0, _mm_loadu_pd(a + i));
+		s1 = _mm_add_pd(s1, _mm_loadu_pd(a + i + 2));
+	}
+	double lanes[2];
+	_mm_storeu_pd(lanes, _mm_add_pd(s0, s1));
+	s = lanes[0] + lanes[1];
+#endif
+	return s + scalarSum(a + i, n - i);
+}
@@ -0,0 +1,344 @@
+/**
+* Concurrent skiplist sorted set, using optimistic fine-grained locking.
+*
+* A skiplist is a sequence of sorted linked lists L0, L1, ..., where
+* L0 holds every element and each list Lr+1 holds (roughly) every
+* other element of Lr. Searching starts in the highest, shortest list
+* and drops down a level whenever the next step would overshoot:
+*
+*   L2  S -----------------> 7 ----------------------> nullptr
+*   L1  S ------> 3 -------> 7 -------> 12 ----------> nullptr
+*   L0  S -> 1 -> 3 -> 4 -> 7 -> 9 -> 12 -> 15 -----> nullptr
+*
+* S is the sentinel, which belongs to every list and holds no data.
+* A node's height is chosen at random when it is added: height 0 with
+* probability 1/2, 1 with probability 1/4, etc.
+*
+* Concurrency (the "lazy" skiplist of Herlihy, Lev, Luchangco and Shavit):
+*
+*   - find() and contains() never lock. They traverse the lists as a
+*     sequential search would, and ignore nodes that are marked or not
+*     yet fully linked.
+*   - add() searches without locks, then locks the predecessor at each
+*     level the new node will occupy and checks nothing has changed.
+*     If something has, the locks are released and the add is retried.
+*   - remove() marks the victim first (the point at which it is
+*     removed as far as other threads are concerned), then locks and
+*     validates the predecessors and unlinks it from every level.
+*
+* Unlinked nodes may still be visited by readers that found them before
+* they were unlinked, so they are retired to the EpochManager instead
+* of being deleted immediately.
+*
+* Performance (expected, without contention):
+*
+*      add(x): O(log(n))
+*   remove(x): O(log(n))
+*     find(x): O(log(n)), wait-free
+*/
+
+#include <new>
+#include <stdexcept>
+
+#include "ds/skiplists.h"
+
+
+/**
+* The next pointers are stored directly after the node so each node
+* is a single allocation, sized for its own height.
+*/
+template <class T>
+SkiplistNode<T>* SkiplistNode<T>::create(T x, int height){
+	void* memory = ::operator new(sizeof(SkiplistNode<T>) + (height+1) * sizeof(std::atomic<SkiplistNode<T>*>));
+	SkiplistNode<T>* u = new (memory) SkiplistNode<T>(x, height);
+	u->next = reinterpret_cast<std::atomic<SkiplistNode<T>*>*>(u + 1);
+	for (int r = 0; r <= height; r++){
+		new (&u->next[r]) std::atomic<SkiplistNode<T>*>(nullptr);
+	}
+	return u;
+}
+
+template <class T>
+void SkiplistNode<T>::destroy(void* p){
+	SkiplistNode<T>* u = static_cast<SkiplistNode<T>*>(p);
+	u->~SkiplistNode<T>();
+	::operator delete(p);
+}
+
+
+template <class T>
+ConcurrentSkiplistSSet<T>::ConcurrentSkiplistSSet(): n(0), h(0){
+	sentinel = SkiplistNode<T>::create(T(), maxHeight-1);
+	sentinel->fullyLinked.store(true);
+}
+
+/**
+* Must not run while other threads are still using the set.
+*/
+template <class T>
+ConcurrentSkiplistSSet<T>::~ConcurrentSkiplistSSet(){
+	SkiplistNode<T>* u = sentinel;
+	while (u != nullptr){
+		SkiplistNode<T>* next = u->next[0].load();
+		SkiplistNode<T>::destroy(u);
+		u = next;
+	}
+}
+
+
+/**
+* Count the trailing one bits of a random number, so each extra level
+* is half as likely as the last. Each thread has its own generator,
+* since rand() isn't thread-safe.
+*/
+template <class T>
+int ConcurrentSkiplistSSet<T>::pickHeight(){
+	static std::atomic<unsigned> seeds(0);
+	static thread_local unsigned z = 2463534242u ^ (seeds.fetch_add(1) * 2654435761u);
+
+	// xorshift32
+	z ^= z << 13;
+	z ^= z >> 17;
+	z ^= z << 5;
+
+	int k = 0;
+	unsigned m = 1;
+	while ((z & m) && k < maxHeight-1){
+		k++;
+		m <<= 1;
+	}
+	return k;
+}
+
+/**
+* Record the last node before x in each list (preds) and the node
+* after it (succs). Returns the highest level at which a node holding
+* x was found, or -1.
+*
+* Lists above h are empty, so the search starts at h. The levels
+* above it are filled in for add(), whose validation will catch a
+* concurrent add that has started using them.
+*/
+template <class T>
+int ConcurrentSkiplistSSet<T>::findPredecessors(T x, SkiplistNode<T>** preds, SkiplistNode<T>** succs){
+	int found = -1;
+	SkiplistNode<T>* u = sentinel;
+	int top = h.load();
+	for (int r = maxHeight-1; r > top; r--){
+		preds[r] = sentinel;
+		succs[r] = sentinel->next[r].load();
+	}
+	for (int r = top; r >= 0; r--){
+		SkiplistNode<T>* w = u->next[r].load();
+		while (w != nullptr && w->x < x){
+			u = w;
+			w = u->next[r].load();
+		}
+		if (found == -1 && w != nullptr && !(x < w->x)){
+			found = r;
+		}
+		preds[r] = u;
+		succs[r] = w;
+	}
+	return found;
+}
+
+/**
+* The same node can be the predecessor on several consecutive levels,
+* but is only locked once.
+*/
+template <class T>
+void ConcurrentSkiplistSSet<T>::unlock(SkiplistNode<T>** preds, int highestLocked){
+	SkiplistNode<T>* previous = nullptr;
+	for (int r = 0; r <= highestLocked; r++){
+		if (preds[r] != previous){
+			preds[r]->lock.unlock();
+			previous = preds[r];
+		}
+	}
+}
+
+
+template <class T>
+int ConcurrentSkiplistSSet<T>::size(){
+	return n.load();
+}
+
+template <class T>
+bool ConcurrentSkiplistSSet<T>::add(T x){
+	EpochGuard guard;
+	int height = pickHeight();
+	int top = h.load();
+	while (height > top && !h.compare_exchange_weak(top, height)) {}
+	SkiplistNode<T>* preds[maxHeight];
+	SkiplistNode<T>* succs[maxHeight];
+
+	while (true){
+		int found = findPredecessors(x, preds, succs);
+		if (found != -1){
+			SkiplistNode<T>* w = succs[found];
+			if (!w->marked.load()){
+				// Already present, wait for the other add to finish
+				while (!w->fullyLinked.load()) {}
+				return false;
+			}
+			continue;	// Being removed, try again once it's gone
+		}
+
+		// Lock the predecessors bottom up, checking they still
+		// link directly to the successors
+		int highestLocked = -1;
+		bool valid = true;
+		SkiplistNode<T>* previous = nullptr;
+		for (int r = 0; valid && r <= height; r++){
+			SkiplistNode<T>* pred = preds[r];
+			SkiplistNode<T>* succ = succs[r];
+			if (pred != previous){
+				pred->lock.lock();
+				previous = pred;
+			}
+			highestLocked = r;
+			valid = !pred->marked.load() && (succ == nullptr || !succ->marked.load())
+				&& pred->next[r].load() == succ;
+		}
+		if (!valid){
+			unlock(preds, highestLocked);
+			continue;
+		}
+
+		SkiplistNode<T>* u = SkiplistNode<T>::create(x, height);
+		for (int r = 0; r <= height; r++){
+			u->next[r].store(succs[r]);
+		}
+		for (int r = 0; r <= height; r++){
+			preds[r]->next[r].store(u);
+		}
+		u->fullyLinked.store(true);
+		n++;
+		unlock(preds, highestLocked);
+		return true;
+	}
+}
+
+/**
+* Throws std::out_of_range if x is not in the set (or another thread
+* removes it first).
+*/
+template <class T>
+T ConcurrentSkiplistSSet<T>::remove(T x){
+	EpochGuard guard;
+	SkiplistNode<T>* preds[maxHeight];
+	SkiplistNode<T>* succs[maxHeight];
+	SkiplistNode<T>* victim = nullptr;
+	bool isMarked = false;
+
+	while (true){
+		int found = findPredecessors(x, preds, succs);
+		if (found != -1){
+			victim = succs[found];
+		}
+		if (!isMarked){
+			// Only remove nodes that are fully linked and found at their own height
+			if (found == -1 || !victim->fullyLinked.load() || victim->height != found || victim->marked.load()){
+				throw std::out_of_range("Could not find x for removal");
+			}
+			victim->lock.lock();
+			if (victim->marked.load()){
+				victim->lock.unlock();
+				throw std::out_of_range("Could not find x for removal");
+			}
+			victim->marked.store(true);
+			isMarked = true;
+		}
+
+		int highestLocked = -1;
+		bool valid = true;
+		SkiplistNode<T>* previous = nullptr;
+		for (int r = 0; valid && r <= victim->height; r++){
+			SkiplistNode<T>* pred = preds[r];
+			if (pred != previous){
+				pred->lock.lock();
+				previous = pred;
+			}
+			highestLocked = r;
+			valid = !pred->marked.load() && pred->next[r].load() == victim;
+		}
+		if (!valid){
+			unlock(preds, highestLocked);
+			continue;
+		}
+
+		for (int r = victim->height; r >= 0; r--){
+			preds[r]->next[r].store(victim->next[r].load());
+		}
+		n--;
+		victim->lock.unlock();
+		unlock(preds, highestLocked);
+		EpochManager::instance().retire(victim, &SkiplistNode<T>::destroy);
+		return x;
+	}
+}
+
+/**
+* Wait-free: no locks, no retries. Nodes that are being added or
+* removed are skipped, as those operations haven't taken effect yet
+* (or already have).
+*/
+template <class T>
+T ConcurrentSkiplistSSet<T>::find(const T& x){
+	EpochGuard guard;
+	SkiplistNode<T>* u = sentinel;
+	SkiplistNode<T>* w = nullptr;
+	for (int r = h.load(); r >= 0; r--){
+		w = u->next[r].load();
+		while (w != nullptr && w->x < x){
+			u = w;
+			w = u->next[r].load();
+		}
+	}
+	while (w != nullptr && (w->marked.load() || !w->fullyLinked.load())){
+		w = w->next[0].load();
+	}
+	if (w == nullptr){
+		throw std::out_of_range("No values larger than x in set");
+	}
+	return w->x;
+}
+
+template <class T>
+bool ConcurrentSkiplistSSet<T>::contains(T x){
+	EpochGuard guard;
+	SkiplistNode<T>* u = sentinel;
+	SkiplistNode<T>* w = nullptr;
+	for (int r = h.load(); r >= 0; r--){
+		w = u->next[r].load();
+		while (w != nullptr && w->x < x){
+			u = w;
+			w = u->next[r].load();
+		}
+		if (w != nullptr && !(x < w->x)){
+			return w->fullyLinked.load() && !w->marked.load();
+		}
+	}
+	return false;
+}
+
+
+template <class T>
+long ConcurrentSkiplistSSet<T>::bytesUsed(){
+	return (long)n.load() * sizeof(T);
+}
+
+/**
+* Walks the bottom list, so takes O(n) time. Nodes that have been
+* removed but not yet freed by the EpochManager aren't counted.
+*/
+template <class T>
+long ConcurrentSkiplistSSet<T>::bytesReserved(){
+	EpochGuard guard;
+	long reserved = 0;
+	for (SkiplistNode<T>* u = sentinel; u != nullptr; u = u->next[0].load()){
+		reserved += sizeof(SkiplistNode<T>) + (u->height + 1) * sizeof(std::atomic<SkiplistNode<T>*>);
+	}
+	return reserved;
+}
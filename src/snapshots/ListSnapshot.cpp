@@ -0,0 +1,76 @@
+/**
+* List snapshots.
+*
+* The elements are written as one contiguous block, in list order, so
+* the file is exactly the memory an ArrayStack holding them would use:
+*
+*   [header][x0][x1][x2] ... [x(n-1)]
+*
+* A ListView maps the file and reads the elements where they lie. Only
+* the pages that are touched are read from disk, so opening a view is
+* O(1) whatever the size of the list, and the page cache is shared by
+* every process that maps the same file.
+*
+* Performance:
+*
+*   saveList(list, path): O(n)
+*       ListView(path):   O(1)
+*            get(i):      O(1)
+*/
+
+#include <stdexcept>
+#include <type_traits>
+
+#include "ds/snapshots.h"
+
+
+template <class T>
+void saveList(IList<T> &list, const char* path){
+	static_assert(std::is_trivially_copyable<T>::value, "snapshots store elements as raw bytes");
+	long n = list.size();
+	Array<T> a(n > 0 ? n : 1);
+	for (long i = 0; i < n; i++){
+		a[i] = list.get(i);
+	}
+	writeSnapshot(path, snapshotHeader(contiguousLayout, sizeof(T), n),
+		reinterpret_cast<const char*>(&a[0]), n * sizeof(T));
+}
+
+template <class T>
+void saveList(DLList<T> &list, const char* path){
+	static_assert(std::is_trivially_copyable<T>::value, "snapshots store elements as raw bytes");
+	long n = list.size();
+	Array<T> a(n > 0 ? n : 1);
+	long i = 0;
+	for (DNode<T>* u = list.end()->next; u != list.end(); u = u->next){
+		a[i++] = u->x;
+	}
+	writeSnapshot(path, snapshotHeader(contiguousLayout, sizeof(T), n),
+		reinterpret_cast<const char*>(&a[0]), n * sizeof(T));
+}
+
+
+template <class T>
+ListView<T>::ListView(const char* path): file(path) {
+	static_assert(std::is_trivially_copyable<T>::value, "snapshots store elements as raw bytes");
+	n = checkSnapshot(file.data(), file.length(), contiguousLayout, sizeof(T), 0);
+	a = reinterpret_cast<const T*>(file.data() + sizeof(SnapshotHeader));
+}
+
+template <class T>
+long ListView<T>::size(){
+	return n;
+}
+
+template <class T>
+T ListView<T>::get(long i){
+	if (i < 0 || i >= n){
+		throw std::out_of_range("index is outside the list");
+	}
+	return a[i];
+}
+
+template <class T>
+const T* ListView<T>::data(){
+	return a;
+}
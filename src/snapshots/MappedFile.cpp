@@ -0,0 +1,160 @@
+/**
+* Read-only file mapping, and the helpers shared by the snapshot
+* readers and writers.
+*
+* A snapshot is a 32 byte SnapshotHeader followed by the elements:
+*
+*   0        8        12       16       20       24                32
+*   [ODSSNAP][version][layout ][size(T)][order  ][n                ][elements...]
+*
+* The header keeps the elements aligned for any T of up to 32 bytes,
+* since mmap returns page aligned memory. Loading checks the magic,
+* version, layout, element size, byte order and file length, and throws
+* std::runtime_error if any of them is wrong, so a view never reads
+* past the end of the mapping or reinterprets another type's bytes.
+*
+* Files are written to path.tmp, synced to disk, and renamed into place,
+* then the directory is synced so the rename itself is durable. A reader,
+* or a crash or power loss part way through, sees either the old
+* snapshot or the new one, never half of one.
+*/
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ds/snapshots.h"
+
+
+inline MappedFile::MappedFile(const char* path){
+	int fd = open(path, O_RDONLY);
+	if (fd < 0){
+		throw std::runtime_error(std::string("could not open ") + path + ": " + std::strerror(errno));
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0){
+		close(fd);
+		throw std::runtime_error(std::string("could not stat ") + path);
+	}
+	len = st.st_size;
+	if (len > 0){
+		void* m = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (m == MAP_FAILED){
+			close(fd);
+			throw std::runtime_error(std::string("could not map ") + path + ": " + std::strerror(errno));
+		}
+		p = static_cast<const char*>(m);
+	}
+	close(fd);	// The mapping stays valid
+}
+
+inline MappedFile::~MappedFile(){
+	if (p != nullptr){
+		munmap(const_cast<char*>(p), len);
+	}
+}
+
+inline const char* MappedFile::data(){
+	return p;
+}
+
+inline size_t MappedFile::length(){
+	return len;
+}
+
+
+inline SnapshotHeader snapshotHeader(unsigned int layout, unsigned int elementSize, long n){
+	SnapshotHeader h;
+	std::memset(&h, 0, sizeof(h));
+	std::memcpy(h.magic, "ODSSNAP", 8);
+	h.version = snapshotVersion;
+	h.layout = layout;
+	h.elementSize = elementSize;
+	h.byteOrder = 0x01020304;
+	h.n = n;
+	return h;
+}
+
+/**
+* Checks the snapshot header at the start of data, and that the length
+* bytes hold its n elements plus extraSlots, with nothing after the last
+* whole element. Returns n.
+*/
+inline long checkSnapshot(const char* data, size_t length, unsigned int layout, unsigned int elementSize, long extraSlots){
+	if (data == nullptr || length < sizeof(SnapshotHeader)){
+		throw std::runtime_error("snapshot is too short for its header");
+	}
+	SnapshotHeader h;
+	std::memcpy(&h, data, sizeof(h));
+	if (std::memcmp(h.magic, "ODSSNAP", 8) != 0){
+		throw std::runtime_error("not a snapshot file");
+	}
+	if (h.version != snapshotVersion){
+		throw std::runtime_error("unsupported snapshot version");
+	}
+	if (h.byteOrder != 0x01020304){
+		throw std::runtime_error("snapshot was written with a different byte order");
+	}
+	if (h.layout != layout){
+		throw std::runtime_error("snapshot has the wrong layout for this view");
+	}
+	if (h.elementSize != elementSize){
+		throw std::runtime_error("snapshot element size does not match the view's type");
+	}
+	if ((length - sizeof(SnapshotHeader)) % elementSize != 0){
+		throw std::runtime_error("snapshot length is not a whole number of elements");
+	}
+	unsigned long long slots = (length - sizeof(SnapshotHeader)) / elementSize;
+	if (h.n > slots || slots - h.n < (unsigned long long)extraSlots){	// h.n + extraSlots could overflow
+		throw std::runtime_error("snapshot is truncated");
+	}
+	return (long)h.n;
+}
+
+/**
+* Flushes the directory holding path, so a file renamed into it is
+* still there after a power loss.
+*/
+inline void syncDirectory(const char* path){
+	std::string dir(path);
+	size_t slash = dir.rfind('/');
+	dir = (slash == std::string::npos) ? "." : (slash == 0) ? "/" : dir.substr(0, slash);
+	int fd = open(dir.c_str(), O_RDONLY);
+	if (fd < 0){
+		throw std::runtime_error("could not open " + dir + ": " + std::strerror(errno));
+	}
+	bool ok = fsync(fd) == 0;
+	close(fd);
+	if (!ok){
+		throw std::runtime_error("could not sync " + dir + ": " + std::strerror(errno));
+	}
+}
+
+/**
+* Writes header and data to path.tmp and syncs it, then renames it to
+* path and syncs the directory.
+*/
+inline void writeSnapshot(const char* path, const SnapshotHeader &h, const char* data, size_t bytes){
+	std::string tmp = std::string(path) + ".tmp";
+	std::FILE* f = std::fopen(tmp.c_str(), "wb");
+	if (f == nullptr){
+		throw std::runtime_error("could not create " + tmp + ": " + std::strerror(errno));
+	}
+	bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1
+		&& (bytes == 0 || std::fwrite(data, bytes, 1, f) == 1)
+		&& std::fflush(f) == 0
+		&& fsync(fileno(f)) == 0;	// The data must be on disk before the rename is
+	ok = (std::fclose(f) == 0) && ok;
+	if (!ok || std::rename(tmp.c_str(), path) != 0){
+		std::remove(tmp.c_str());
+		throw std::runtime_error(std::string("could not write ") + path);
+	}
+	syncDirectory(path);
+}
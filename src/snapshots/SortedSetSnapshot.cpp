@@ -0,0 +1,109 @@
+/**
+* Sorted set snapshots in Eytzinger order.
+*
+* A balanced binary search tree can be stored without pointers by
+* laying it out breadth first, like a BinaryHeap: the root at 1, and
+* the children of k at 2k and 2k+1. Filling those slots with an
+* in-order walk puts the sorted values in search tree order:
+*
+*   sorted:  1 2 3 4 5 6 7          b: _ 4 2 6 1 3 5 7
+*                                      0 1 2 3 4 5 6 7
+*                 4
+*               /   \
+*              2     6
+*             / \   / \
+*            1   3 5   7
+*
+* The file holds b[0..n], with b[0] unused, so a SortedSetView can
+* search the mapped array directly. The top levels of the tree share
+* a few cache lines (and pages), which stay hot across searches, so
+* a search touches far fewer distinct lines than a binary search of a
+* sorted array, and no pointers are followed at all.
+*
+* find(x) descends without branching on the comparison, recording each
+* step as a bit of k. When it falls off the bottom, the last step to
+* the left was at the answer, and k's trailing one bits (the steps to
+* the right after it) plus one more are shifted away to get back there:
+*
+*   k = 1
+*   while k <= n: k = 2k + (b[k] < x)
+*   k >>= ffs(~k)        (0 if every step went right, so nothing is >= x)
+*
+* Performance:
+*
+*   saveSortedSet(s, path): O(n)
+*    SortedSetView(path):   O(1)
+*              find(x):     O(log(n))
+*/
+
+#include <stdexcept>
+#include <type_traits>
+
+#include "ds/snapshots.h"
+
+
+/**
+* Fills b[k] and its subtree from sorted[i...], returning the next i.
+*/
+template <class T>
+long eytzingerFill(Array<T> &sorted, Array<T> &b, long i, long k, long n){
+	if (k <= n){
+		i = eytzingerFill(sorted, b, i, 2*k, n);
+		b[k] = sorted[i++];
+		i = eytzingerFill(sorted, b, i, 2*k + 1, n);
+	}
+	return i;
+}
+
+template <class Set>
+void saveSortedSet(Set &set, const char* path){
+	typedef typename Set::iterator::value_type T;
+	static_assert(std::is_trivially_copyable<T>::value, "snapshots store elements as raw bytes");
+
+	Array<T> sorted(set.size() + 1);
+	long n = 0;
+	for (typename Set::iterator it = set.begin(); it != set.end(); ++it){
+		sorted[n++] = *it;
+	}
+	Array<T> b(n + 1);
+	b[0] = T();
+	eytzingerFill(sorted, b, 0, 1, n);
+	writeSnapshot(path, snapshotHeader(eytzingerLayout, sizeof(T), n),
+		reinterpret_cast<const char*>(&b[0]), (n + 1) * sizeof(T));
+}
+
+
+template <class T>
+SortedSetView<T>::SortedSetView(const char* path): file(path) {
+	static_assert(std::is_trivially_copyable<T>::value, "snapshots store elements as raw bytes");
+	n = checkSnapshot(file.data(), file.length(), eytzingerLayout, sizeof(T), 1);
+	b = reinterpret_cast<const T*>(file.data() + sizeof(SnapshotHeader));
+}
+
+template <class T>
+long SortedSetView<T>::size(){
+	return n;
+}
+
+template <class T>
+T SortedSetView<T>::find(T x){
+	unsigned long k = 1;
+	while (k <= (unsigned long)n){
+		k = 2*k + (b[k] < x);
+	}
+	k >>= __builtin_ffsl(~k);
+	if (k == 0){
+		throw std::out_of_range("No values larger than x in set");
+	}
+	return b[k];
+}
+
+template <class T>
+bool SortedSetView<T>::contains(T x){
+	unsigned long k = 1;
+	while (k <= (unsigned long)n){
+		k = 2*k + (b[k] < x);
+	}
+	k >>= __builtin_ffsl(~k);
+	return k != 0 && !(x < b[k]);
+}
@@ -0,0 +1,157 @@
+/**
+* Merge sort.
+*
+* Sort the two halves of the array recursively, then merge them by
+* repeatedly taking the smaller of the two front elements:
+*
+*   5 2 8 1 | 9 3 7 4     sort each half
+*   1 2 5 8 | 3 4 7 9     merge
+*   1 2 3 4 5 7 8 9
+*
+* Merging can't be done in place, so a second array of n elements is
+* needed. Rather than merging into it and copying back at every level,
+* the two arrays swap roles from one level to the next: each level
+* merges from one array into the other, so every element is moved
+* once per level. Short ranges are finished off with insertion sort,
+* which is faster than recursing all the way down to single elements.
+*
+* Equal elements keep their original order (the sort is stable), and
+* the running time doesn't depend on the input, unlike quickSort.
+*
+* parallelMergeSort() sorts the two halves on separate threads, and
+* also splits each merge in two: the middle element of the longer run
+* is placed with a binary search in the other run, and the elements
+* on either side of it are merged independently.
+*
+* Performance:
+*
+*           mergeSort(a, n): O(n log(n)), plus O(n) extra space
+*   parallelMergeSort(a, n): O(n log(n)) work, shared between the cores
+*/
+
+#include <algorithm>
+
+#include "ds/sorting.h"
+
+
+template <class T>
+void mergeSort(T* a, int n){
+	if (n < 2){
+		return;
+	}
+	Array<T> tmp(n);
+	mergeSortInPlace(a, &tmp[0], n, 0);
+}
+
+template <class T>
+void parallelMergeSort(T* a, int n){
+	if (n < 2){
+		return;
+	}
+	Array<T> tmp(n);
+	mergeSortInPlace(a, &tmp[0], n, forkDepth(n));
+}
+
+
+template <class T>
+void insertionSort(T* a, int n){
+	for (int i = 1; i < n; i++){
+		T x = a[i];
+		int j = i;
+		while (j > 0 && x < a[j-1]){
+			a[j] = a[j-1];
+			j--;
+		}
+		a[j] = x;
+	}
+}
+
+/**
+* Merge the sorted runs x and y into out. On ties the element from x
+* comes first, which is what makes the sort stable.
+*/
+template <class T>
+void merge(T* x, int nx, T* y, int ny, T* out){
+	int i = 0;
+	int j = 0;
+	while (i < nx && j < ny){
+		// Written without branches, since on random input they are unpredictable
+		bool takeY = y[j] < x[i];
+		*out++ = takeY ? y[j] : x[i];
+		j += takeY;
+		i += !takeY;
+	}
+	out = std::copy(x + i, x + nx, out);
+	std::copy(y + j, y + ny, out);
+}
+
+template <class T>
+void parallelMerge(T* x, int nx, T* y, int ny, T* out, int depth){
+	const int grain = 8192;
+	if (depth <= 0 || nx + ny < grain){
+		merge(x, nx, y, ny, out);
+		return;
+	}
+	int mx;
+	int my;
+	if (nx >= ny){
+		// Elements of y equal to x[mx] must go after it
+		mx = nx / 2;
+		my = std::lower_bound(y, y + ny, x[mx]) - y;
+		out[mx + my] = x[mx];
+		forkJoin(true,
+			[=](){ parallelMerge(x, mx, y, my, out, depth-1); },
+			[=](){ parallelMerge(x + mx + 1, nx - mx - 1, y + my, ny - my, out + mx + my + 1, depth-1); });
+	} else {
+		// Elements of x equal to y[my] must go before it
+		my = ny / 2;
+		mx = std::upper_bound(x, x + nx, y[my]) - x;
+		out[mx + my] = y[my];
+		forkJoin(true,
+			[=](){ parallelMerge(x, mx, y, my, out, depth-1); },
+			[=](){ parallelMerge(x + mx, nx - mx, y + my + 1, ny - my - 1, out + mx + my + 1, depth-1); });
+	}
+}
+
+/**
+* Sort a[0..n-1], using tmp[0..n-1] as scratch space.
+*/
+template <class T>
+void mergeSortInPlace(T* a, T* tmp, int n, int depth){
+	const int cutoff = 24;
+	if (n <= cutoff){
+		insertionSort(a, n);
+		return;
+	}
+	int m = n / 2;
+	forkJoin(depth > 0,
+		[=](){ mergeSortInto(a, tmp, m, depth-1); },
+		[=](){ mergeSortInto(a + m, tmp + m, n - m, depth-1); });
+	if (!(tmp[m] < tmp[m-1])){
+		std::copy(tmp, tmp + n, a);	// Already in order
+	} else {
+		parallelMerge(tmp, m, tmp + m, n - m, a, depth);
+	}
+}
+
+/**
+* Sort the elements of a[0..n-1] into dst[0..n-1], using a as scratch space.
+*/
+template <class T>
+void mergeSortInto(T* a, T* dst, int n, int depth){
+	const int cutoff = 24;
+	if (n <= cutoff){
+		std::copy(a, a + n, dst);
+		insertionSort(dst, n);
+		return;
+	}
+	int m = n / 2;
+	forkJoin(depth > 0,
+		[=](){ mergeSortInPlace(a, dst, m, depth-1); },
+		[=](){ mergeSortInPlace(a + m, dst + m, n - m, depth-1); });
+	if (!(a[m] < a[m-1])){
+		std::copy(a, a + n, dst);
+	} else {
+		parallelMerge(a, m, a + m, n - m, dst, depth);
+	}
+}
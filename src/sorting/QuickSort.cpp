@@ -0,0 +1,61 @@
+/**
+* Quicksort.
+*
+* Pick a random element of the array as the pivot and partition the
+* array into three parts: elements smaller than the pivot, elements
+* equal to it and elements larger than it. Then sort the first and
+* last parts recursively.
+*
+*   5 2 8 1 5 3   pivot 5
+*   2 1 3 5 5 8   partition
+*   < < < = = >
+*
+* Unlike mergeSort, no extra array is needed, and the random pivot
+* makes the expected running time O(n log(n)) for every input. Keeping
+* the elements equal to the pivot in the middle means arrays with many
+* duplicates don't degrade to quadratic time. To bound the depth of
+* recursion, only the smaller part is sorted recursively; the larger
+* one is handled by the next iteration of the loop.
+*
+* The sort is not stable.
+*
+* Performance:
+*
+*   quickSort(a, n): O(n log(n)) expected, O(log(n)) extra space
+*/
+
+#include <stdlib.h>
+#include <utility>
+
+#include "ds/sorting.h"
+
+
+template <class T>
+void quickSort(T* a, int n){
+	const int cutoff = 16;
+	while (n > cutoff){
+		T x = a[rand() % n];
+		// a[0..p-1] < x, a[p..j-1] == x, a[q..n-1] > x
+		int p = 0;
+		int j = 0;
+		int q = n;
+		while (j < q){
+			if (a[j] < x){
+				std::swap(a[j++], a[p++]);
+			} else if (x < a[j]){
+				std::swap(a[j], a[--q]);
+			} else {
+				j++;
+			}
+		}
+		if (p < n - q){
+			quickSort(a, p);
+			a += q;
+			n -= q;
+		} else {
+			quickSort(a + q, n - q);
+			n = p;
+		}
+	}
+	insertionSort(a, n);
+}
@@ -0,0 +1,170 @@
+/**
+* Counting sort and radix sort.
+*
+* Integers can be sorted without comparing them. Counting sort handles
+* keys in a small range [0, k): count how many times each key occurs,
+* turn the counts into the position where each key's run starts, then
+* copy every element straight to its position.
+*
+*   a = 2 0 2 1 0      counts 2 1 2      starts 0 2 3
+*   b = 0 0 1 2 2
+*
+* Radix sort applies the same idea to w-bit integers, one 8-bit digit
+* at a time, starting with the least significant. Each pass is stable,
+* so after the last pass the elements are ordered by every digit.
+* Signed integers are handled by flipping the sign bit, which maps
+* them onto unsigned values in the same order. The counts for every
+* pass are gathered in a single read of the array, and passes where
+* every element has the same digit (eg the high bytes of small
+* numbers) are skipped.
+*
+* parallelRadixSort() splits the array into one chunk per task. In
+* each pass every task counts the digits in its chunk, the counts are
+* combined so each (digit, task) pair gets its own range of the output,
+* and then every task copies its chunk into place independently.
+*
+* Performance:
+*
+*     countingSort(a, n, k): O(n + k), plus O(n + k) extra space
+*         radixSort(a, n): O(n w/8), plus O(n) extra space
+*   parallelRadixSort(a, n): O(n w/8) work, shared between the cores
+*/
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "ds/sorting.h"
+
+
+template <class T>
+void countingSort(T* a, int n, int k){
+	if (n < 2){
+		return;
+	}
+	Array<int> c(k);
+	std::fill(&c[0], &c[0] + k, 0);
+	for (int i = 0; i < n; i++){
+		c[a[i]]++;
+	}
+	int start = 0;
+	for (int x = 0; x < k; x++){
+		int count = c[x];
+		c[x] = start;
+		start += count;
+	}
+	Array<T> b(n);
+	for (int i = 0; i < n; i++){
+		b[c[a[i]]++] = a[i];
+	}
+	std::copy(&b[0], &b[0] + n, a);
+}
+
+/**
+* The 8-bit digit of x starting at bit shift, with the sign bit of
+* signed types flipped so negative numbers sort first.
+*/
+template <class T>
+int radixDigit(T x, int shift){
+	typedef typename std::make_unsigned<T>::type U;
+	const U signBit = std::is_signed<T>::value ? (U)1 << (8*sizeof(T) - 1) : 0;
+	return (int)((((U)x ^ signBit) >> shift) & 0xff);
+}
+
+template <class T>
+void radixSort(T* a, int n){
+	const int passes = sizeof(T);
+	if (n < 2){
+		return;
+	}
+	int counts[passes][256];
+	std::fill(&counts[0][0], &counts[0][0] + passes*256, 0);
+	for (int i = 0; i < n; i++){
+		for (int p = 0; p < passes; p++){
+			counts[p][radixDigit(a[i], 8*p)]++;
+		}
+	}
+
+	Array<T> tmp(n);
+	T* src = a;
+	T* dst = &tmp[0];
+	for (int p = 0; p < passes; p++){
+		int shift = 8*p;
+		int* c = counts[p];
+		if (c[radixDigit(src[0], shift)] == n){
+			continue;	// Every element has the same digit
+		}
+		int start = 0;
+		for (int d = 0; d < 256; d++){
+			int count = c[d];
+			c[d] = start;
+			start += count;
+		}
+		for (int i = 0; i < n; i++){
+			dst[c[radixDigit(src[i], shift)]++] = src[i];
+		}
+		std::swap(src, dst);
+	}
+	if (src != a){
+		std::copy(src, src + n, a);
+	}
+}
+
+template <class T>
+void parallelRadixSort(T* a, int n){
+	const int passes = sizeof(T);
+	int tasks = 1 << forkDepth(n);
+	if (tasks == 1){
+		radixSort(a, n);
+		return;
+	}
+	int chunk = (n + tasks - 1) / tasks;
+	Array<T> tmp(n);
+	Array<int> counts(tasks * 256);	// One row of counts per task
+	int* c = &counts[0];
+	T* src = a;
+	T* dst = &tmp[0];
+
+	for (int p = 0; p < passes; p++){
+		int shift = 8*p;
+		forkEach(tasks, [=](int t){
+			int* ct = c + 256*t;
+			std::fill(ct, ct + 256, 0);
+			int end = std::min(n, (t+1) * chunk);
+			for (int i = t * chunk; i < end; i++){
+				ct[radixDigit(src[i], shift)]++;
+			}
+		});
+
+		int d0 = radixDigit(src[0], shift);
+		int same = 0;
+		for (int t = 0; t < tasks; t++){
+			same += c[256*t + d0];
+		}
+		if (same == n){
+			continue;	// Every element has the same digit
+		}
+
+		// Elements with a smaller digit go first, then those from earlier chunks
+		int start = 0;
+		for (int d = 0; d < 256; d++){
+			for (int t = 0; t < tasks; t++){
+				int count = c[256*t + d];
+				c[256*t + d] = start;
+				start += count;
+			}
+		}
+
+		forkEach(tasks, [=](int t){
+			int* ct = c + 256*t;
+			int end = std::min(n, (t+1) * chunk);
+			for (int i = t * chunk; i < end; i++){
+				dst[ct[radixDigit(src[i], shift)]++] = src[i];
+			}
+		});
+		std::swap(src, dst);
+	}
+	if (src != a){
+		std::copy(src, src + n, a);
+	}
+}
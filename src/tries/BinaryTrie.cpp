@@ -0,0 +1,252 @@
+/**
+* Sorted set of w-bit unsigned integers.
+*
+* Each value is stored as a root to leaf path in a binary tree of
+* depth w: the i-th bit of the value (from the most significant)
+* chooses the left or right child at depth i. Values sharing a prefix
+* share the nodes for it. With w = 3:
+*
+*                root
+*             0/      \1
+*             o        o
+*          0/  \1       \1
+*          o    o        o
+*         1\   0/ \1    0/
+*          1   2   3    6       values 1, 2, 3 and 6
+*
+* The leaves are also linked in sorted order in a doubly linked list,
+* so once one leaf is found its neighbours are a step away.
+*
+* find(x) follows the path to x. If x isn't present the path stops at
+* some node u that is missing the child x would need. Every node with a
+* single child keeps a jump pointer to the leaf nearest the missing
+* side: the smallest leaf under it if the left child is missing, the
+* largest if the right child is missing. So the successor of x is
+* either u's jump pointer or the leaf after it.
+*
+* The cost of every operation depends on w, not on n, and there are
+* no comparisons between values, so tries suit integer keys. On the
+* other hand, every value needs up to w nodes.
+*
+* All nodes are created as N, so a subclass of BinaryTrieNode can
+* carry extra data for each value; findLeaf(x) gives access to it.
+*
+* Performance:
+*
+*      add(x): O(w)
+*   remove(x): O(w)
+*     find(x): O(w)
+*/
+
+#include <stdexcept>
+
+#include "ds/tries.h"
+
+
+template <class T, class N>
+BinaryTrie<T, N>::BinaryTrie(): n(0) {
+	root.jump = &dummy;
+	dummy.child[prev] = &dummy;
+	dummy.child[next] = &dummy;
+}
+
+template <class T, class N>
+BinaryTrie<T, N>::~BinaryTrie(){
+	deleteNodes(root.child[0], 1);
+	deleteNodes(root.child[1], 1);
+}
+
+/**
+* The children of leaves point along the list of leaves,
+* so the depth is needed to know when to stop.
+*/
+template <class T, class N>
+void BinaryTrie<T, N>::deleteNodes(Node* u, int depth){
+	if (u == nullptr){
+		return;
+	}
+	if (depth < w){
+		deleteNodes(u->child[0], depth+1);
+		deleteNodes(u->child[1], depth+1);
+	}
+	delete static_cast<N*>(u);
+}
+
+template <class T, class N>
+long BinaryTrie<T, N>::countNodes(Node* u, int depth){
+	if (u == nullptr){
+		return 0;
+	}
+	if (depth < w){
+		return 1 + countNodes(u->child[0], depth+1) + countNodes(u->child[1], depth+1);
+	}
+	return 1;
+}
+
+template <class T, class N>
+int BinaryTrie<T, N>::bit(T x, int i){
+	return (x >> (w-i-1)) & 1;
+}
+
+template <class T, class N>
+typename BinaryTrie<T, N>::Node* BinaryTrie<T, N>::deepestPrefix(T x, int &i){
+	Node* u = &root;
+	for (i = 0; i < w; i++){
+		Node* v = u->child[bit(x, i)];
+		if (v == nullptr){
+			break;
+		}
+		u = v;
+	}
+	return u;
+}
+
+/**
+* u is the deepest node on the path to x, at depth i < w.
+* Returns the leaf holding the successor of x, or dummy if there isn't one.
+*/
+template <class T, class N>
+typename BinaryTrie<T, N>::Node* BinaryTrie<T, N>::successorLeaf(Node* u, int i, T x){
+	if (bit(x, i) == 0){
+		return u->jump;	// Smallest leaf in the right subtree
+	} else {
+		return u->jump->child[next];	// Leaf after the largest in the left subtree
+	}
+}
+
+
+template <class T, class N>
+int BinaryTrie<T, N>::size(){
+	return n;
+}
+
+template <class T, class N>
+T BinaryTrie<T, N>::find(const T& x){
+	N* u = findLeaf(x);
+	if (u == nullptr){
+		throw std::out_of_range("No values larger than x in trie");
+	}
+	return u->x;
+}
+
+template <class T, class N>
+N* BinaryTrie<T, N>::findLeaf(T x){
+	int i;
+	Node* u = deepestPrefix(x, i);
+	if (i < w){
+		u = successorLeaf(u, i, x);
+	}
+	return (u == &dummy) ? nullptr : static_cast<N*>(u);
+}
+
+template <class T, class N>
+bool BinaryTrie<T, N>::add(T x){
+	return addLeaf(x) != nullptr;
+}
+
+template <class T, class N>
+T BinaryTrie<T, N>::remove(T x){
+	removeLeaf(x);
+	return x;
+}
+
+/**
+* Adds the missing part of the path to x, links the new leaf in after
+* its predecessor, then walks back up fixing the jump pointers that
+* should now point to the new leaf.
+*/
+template <class T, class N>
+N* BinaryTrie<T, N>::addLeaf(T x){
+	int i;
+	Node* u = deepestPrefix(x, i);
+	if (i == w){
+		return nullptr;	// Already present
+	}
+	Node* pred = (bit(x, i) == 1) ? u->jump : u->jump->child[prev];
+	u->jump = nullptr;	// u is about to have two children
+
+	for (; i < w; i++){
+		int c = bit(x, i);
+		Node* v = new N();
+		v->parent = u;
+		u->child[c] = v;
+		u = v;
+	}
+	u->x = x;
+
+	u->child[prev] = pred;
+	u->child[next] = pred->child[next];
+	u->child[prev]->child[next] = u;
+	u->child[next]->child[prev] = u;
+
+	for (Node* v = u->parent; v != nullptr; v = v->parent){
+		if ((v->child[0] == nullptr && (v->jump == nullptr || x < v->jump->x))
+				|| (v->child[1] == nullptr && (v->jump == nullptr || x > v->jump->x))){
+			v->jump = u;
+		}
+	}
+	n++;
+	return static_cast<N*>(u);
+}
+
+/**
+* Unlinks the leaf holding x and deletes the nodes that only led to it.
+* The deepest remaining node now has a single child, so gets a jump
+* pointer, and ancestors that jumped to the removed leaf jump to its
+* neighbour instead.
+*/
+template <class T, class N>
+int BinaryTrie<T, N>::removeLeaf(T x){
+	int i;
+	Node* u = deepestPrefix(x, i);
+	if (i < w){
+		throw std::out_of_range("Could not find x for removal");
+	}
+	u->child[prev]->child[next] = u->child[next];
+	u->child[next]->child[prev] = u->child[prev];
+
+	Node* v = u;
+	for (i = w-1; i >= 0; i--){
+		int c = bit(x, i);
+		v = v->parent;
+		Node* gone = v->child[c];
+		v->child[c] = nullptr;
+		if (gone != u){
+			delete static_cast<N*>(gone);
+		}
+		if (v->child[1-c] != nullptr){
+			break;
+		}
+	}
+
+	if (i < 0){
+		root.jump = &dummy;	// The trie is empty
+	} else {
+		v->jump = u->child[1 - bit(x, i)];
+		int d = i - 1;
+		for (v = v->parent; v != nullptr; v = v->parent, d--){
+			if (v->jump == u){
+				v->jump = u->child[bit(x, d)];
+			}
+		}
+	}
+	delete static_cast<N*>(u);
+	n--;
+	return i;
+}
+
+
+template <class T, class N>
+long BinaryTrie<T, N>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+/**
+* Every value has a path of w nodes, shared with the values that have
+* the same prefix. Counting them takes time proportional to the number
+* of nodes.
+*/
+template <class T, class N>
+long BinaryTrie<T, N>::bytesReserved(){
+	return (countNodes(root.child[0], 1) + countNodes(root.child[1], 1)) * (long)sizeof(N);
+}
@@ -0,0 +1,87 @@
+/**
+* BinaryTrie with a faster search.
+*
+* The nodes on the path to x are exactly the nodes for the prefixes of
+* x, and if the i-bit prefix of x is in the trie, so are all of the
+* shorter ones. So the deepest node on the path can be found with a
+* binary search over the depths, if each depth keeps a hash table of
+* its nodes keyed by prefix:
+*
+*   x = 1011, depths 0..4
+*   t[2] has 10?   yes, search deeper
+*   t[3] has 101?  no, search shallower  -> deepest node is at depth 2
+*
+* add(x) and remove(x) still walk the whole path to update the tables,
+* but find(x) only makes O(log(w)) hash table lookups.
+*
+* Performance:
+*
+*      add(x): O(w) expected
+*   remove(x): O(w) expected
+*     find(x): O(log(w)) expected
+*/
+
+#include "ds/tries.h"
+
+
+template <class T, class N>
+typename XFastTrie<T, N>::Node* XFastTrie<T, N>::deepestPrefix(T x, int &i){
+	const int w = 8 * sizeof(T);
+	Node* u = &this->root;
+	int l = 0;
+	int h = w + 1;
+	while (h - l > 1){
+		int m = (l + h) / 2;
+		Node** v = t[m].lookup(x >> (w - m));
+		if (v == nullptr){
+			h = m;
+		} else {
+			u = *v;
+			l = m;
+		}
+	}
+	i = l;
+	return u;
+}
+
+/**
+* The new nodes are the leaf and its ancestors up to the first one
+* already in the tables.
+*/
+template <class T, class N>
+bool XFastTrie<T, N>::add(T x){
+	const int w = 8 * sizeof(T);
+	Node* u = this->addLeaf(x);
+	if (u == nullptr){
+		return false;
+	}
+	for (int d = w; d > 0; d--, u = u->parent){
+		if (!t[d].put(x >> (w - d), u)){
+			break;
+		}
+	}
+	return true;
+}
+
+template <class T, class N>
+T XFastTrie<T, N>::remove(T x){
+	const int w = 8 * sizeof(T);
+	int i = this->removeLeaf(x);	// Throws if x is not in the trie
+	for (int d = (i < 0) ? 1 : i+1; d <= w; d++){
+		t[d].remove(x >> (w - d));
+	}
+	return x;
+}
+
+
+/**
+* The nodes, plus the hash tables indexing them by prefix.
+*/
+template <class T, class N>
+long XFastTrie<T, N>::bytesReserved(){
+	long reserved = BinaryTrie<T, N>::bytesReserved() + (long)t.length() * sizeof(SwissHashMap<T, Node*>);
+	for (int i = 0; i < t.length(); i++){
+		reserved += t[i].bytesReserved();
+	}
+	return reserved;
+}
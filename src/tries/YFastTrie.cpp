@@ -0,0 +1,121 @@
+/**
+* Sorted set of w-bit unsigned integers with fast searches and
+* (unlike the XFastTrie) only a constant number of nodes per value.
+*
+* The values are split into buckets of consecutive values. Each bucket
+* is a Treap, and the XFastTrie holds one key per bucket, its largest
+* value. To find x, the XFastTrie finds the first key >= x, which
+* picks out the only bucket that can hold x or its successor:
+*
+*   keys:      7         19             max
+*   buckets: {2,5,7} {9,12,19} {23,30,31,40}
+*
+* When a value is added, it becomes a key with probability 1/w,
+* splitting its bucket in two. So buckets hold O(w) values on average,
+* searching them takes O(log(w)) expected time, and the XFastTrie only
+* has O(n/w) keys, each costing O(w) nodes.
+*
+* When a key is removed, its bucket is merged into the next one. The
+* last bucket's key is the largest possible value, and stays even if
+* that value isn't in the set.
+*
+* Performance:
+*
+*      add(x): O(log(w)) expected, amortized
+*   remove(x): O(log(w)) expected, amortized
+*     find(x): O(log(w)) expected
+*/
+
+#include <stdlib.h>
+
+#include "ds/tries.h"
+
+
+template <class T>
+YFastTrie<T>::YFastTrie(): n(0) {
+	T last = ~(T)0;
+	keys.add(last);
+	keys.findLeaf(last)->bucket = new Treap<T>();
+}
+
+template <class T>
+YFastTrie<T>::~YFastTrie(){
+	T last = ~(T)0;
+	YFastTrieNode<T>* u = keys.findLeaf(0);
+	while (true){
+		delete u->bucket;
+		if (u->x == last){
+			break;
+		}
+		u = static_cast<YFastTrieNode<T>*>(u->child[1]);	// Next leaf
+	}
+}
+
+
+template <class T>
+int YFastTrie<T>::size(){
+	return n;
+}
+
+template <class T>
+T YFastTrie<T>::find(const T& x){
+	Treap<T>* bucket = keys.findLeaf(x)->bucket;
+	return bucket->find(x);	// Throws if only the last bucket could hold a larger value
+}
+
+template <class T>
+bool YFastTrie<T>::add(T x){
+	YFastTrieNode<T>* u = keys.findLeaf(x);
+	if (!u->bucket->add(x)){
+		return false;
+	}
+	n++;
+	if (x != u->x && rand() % w == 0){
+		// x becomes a key, taking the values <= x into a new bucket
+		Treap<T>* smaller = new Treap<T>();
+		u->bucket->splitAt(x, *smaller);
+		keys.add(x);
+		keys.findLeaf(x)->bucket = smaller;
+	}
+	return true;
+}
+
+template <class T>
+T YFastTrie<T>::remove(T x){
+	T last = ~(T)0;
+	YFastTrieNode<T>* u = keys.findLeaf(x);
+	u->bucket->remove(x);	// Throws if x is not in the set
+	n--;
+	if (x == u->x && x != last){
+		// Merge the bucket into the next one
+		Treap<T>* bucket = u->bucket;
+		keys.remove(x);
+		keys.findLeaf(x)->bucket->unionWith(*bucket);
+		delete bucket;
+	}
+	return x;
+}
+
+
+template <class T>
+long YFastTrie<T>::bytesUsed(){
+	return (long)n * sizeof(T);
+}
+
+/**
+* The XFastTrie of keys, plus every bucket.
+*/
+template <class T>
+long YFastTrie<T>::bytesReserved(){
+	long reserved = keys.bytesReserved();
+	T last = ~(T)0;
+	YFastTrieNode<T>* u = keys.findLeaf(0);
+	while (true){
+		reserved += sizeof(Treap<T>) + u->bucket->bytesReserved();
+		if (u->x == last){
+			break;
+		}
+		u = static_cast<YFastTrieNode<T>*>(u->child[1]);	// Next leaf
+	}
+	return reserved;
+}